@@ -81,6 +81,12 @@ template <class Key> class TopStatsCounter
 public:
   void Add(Key const & key) { ++m_data[key]; }
 
+  void Merge(TopStatsCounter const & rhs)
+  {
+    for (auto const & p : rhs.m_data)
+      m_data[p.first] += p.second;
+  }
+
   void PrintTop(size_t count) const
   {
     ASSERT(count > 0, ());
@@ -0,0 +1,68 @@
+#include "testing/benchmark.hpp"
+#include "testing/testing.hpp"
+
+#include "coding/files_container.hpp"
+#include "coding/reader.hpp"
+#include "coding/varint.hpp"
+
+#include "platform/platform.hpp"
+
+#include "base/string_utils.hpp"
+
+#include "defines.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace varint_benchmark
+{
+using namespace std;
+
+BENCHMARK_TEST(ReadVarUint64ArrayFast)
+{
+  // Outer geometry blobs of all scales: [varuint size][deltas] for paths and
+  // [varuint chains count]([varuint size][deltas])* for triangles.
+  FilesContainerR container(GetPlatform().GetReader("minsk-pass" DATA_FILE_EXTENSION));
+  vector<vector<char>> blobs;
+  for (char const * tag : {GEOMETRY_FILE_TAG, TRIANGLE_FILE_TAG})
+  {
+    bool const isTriangles = strcmp(tag, TRIANGLE_FILE_TAG) == 0;
+    for (size_t ind = 0; ind < 4; ++ind)
+    {
+      string const section = tag + strings::to_string(ind);
+      if (!container.IsExist(section))
+        continue;
+
+      ReaderSource<FilesContainerR::TReader> src(container.GetReader(section));
+      while (src.Size() > 0)
+      {
+        uint32_t const count = isTriangles ? ReadVarUint<uint32_t>(src) : 1;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+          blobs.emplace_back(ReadVarUint<uint32_t>(src));
+          src.Read(blobs.back().data(), blobs.back().size());
+        }
+      }
+    }
+  }
+  TEST(!blobs.empty(), ());
+
+  uint64_t sum1 = 0;
+  BENCHMARK_N_TIMES(1000, 10.0)
+  {
+    for (auto const & blob : blobs)
+      ReadVarUint64Array(blob.data(), blob.data() + blob.size(), [&sum1](uint64_t v) { sum1 += v; });
+  }
+
+  uint64_t sum2 = 0;
+  BENCHMARK_N_TIMES(1000, 10.0)
+  {
+    for (auto const & blob : blobs)
+      ReadVarUint64ArrayFast(blob.data(), blob.data() + blob.size(), [&sum2](uint64_t v) { sum2 += v; });
+  }
+
+  TEST_EQUAL(sum1, sum2, ());
+}
+}  // namespace varint_benchmark
@@ -40,4 +40,23 @@ UNIT_TEST(SHA1_Smoke)
   for (size_t i = 0; i < std::size(bytes); ++i)
     TEST_EQUAL(SHA1::CalculateForString(bytes[i]), encoded[i], ());
 }
+
+UNIT_TEST(SHA1_Hasher)
+{
+  std::string_view const str = "Organic Maps is the ultimate companion app for travellers, tourists, hikers, and cyclists!";
+
+  for (size_t partSize : {1, 3, 64, 1000})
+  {
+    SHA1::Hasher hasher;
+    for (size_t i = 0; i < str.size(); i += partSize)
+    {
+      auto const part = str.substr(i, partSize);
+      hasher.Update(part.data(), part.size());
+    }
+    TEST_EQUAL(hasher.Finish(), SHA1::CalculateForString(str), (partSize));
+  }
+
+  SHA1::Hasher empty;
+  TEST_EQUAL(SHA1::ToBase64(empty.Finish()), SHA1::ToBase64(SHA1::CalculateForString({})), ());
+}
 }
@@ -6,6 +6,7 @@
 #include "base/macros.hpp"
 #include "base/stl_helpers.hpp"
 
+#include <random>
 #include <vector>
 
 using namespace std;
@@ -181,3 +182,28 @@ UNIT_TEST(ReadVarInt64Array)
   }
 }
 
+UNIT_TEST(ReadVarUint64ArrayFast)
+{
+  mt19937_64 rng(0);
+  for (size_t count : {0, 1, 2, 7, 8, 9, 100, 1000})
+  {
+    vector<uint64_t> values;
+    vector<uint8_t> data;
+    PushBackByteSink<vector<uint8_t>> dst(data);
+    for (size_t i = 0; i < count; ++i)
+    {
+      // Mix values of all varint sizes from 1 to 10 bytes.
+      uint64_t const v = rng() >> (rng() % 64);
+      values.push_back(v);
+      WriteVarUint(dst, v);
+    }
+
+    void const * pDataStart = data.data();
+    void const * pDataEnd = data.data() + data.size();
+
+    vector<uint64_t> result;
+    void const * pEnd = ReadVarUint64ArrayFast(pDataStart, pDataEnd, base::MakeBackInsertFunctor(result));
+    TEST_EQUAL(pEnd, pDataEnd, (count));
+    TEST_EQUAL(result, values, (count));
+  }
+}
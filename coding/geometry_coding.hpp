@@ -247,7 +247,7 @@ void LoadOuter(DecodeFunT fn, TSource & src, GeometryCodingParams const & params
 
   DeltasT deltas;
   deltas.reserve(count / 2);
-  ReadVarUint64Array(p, p + count, base::MakeBackInsertFunctor(deltas));
+  ReadVarUint64ArrayFast(p, p + count, base::MakeBackInsertFunctor(deltas));
 
   Decode(fn, deltas, params, points, reserveF);
 }
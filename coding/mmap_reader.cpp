@@ -4,6 +4,7 @@
 
 #include "std/target_os.hpp"
 
+#include <cerrno>
 #include <cstring>
 
 #ifdef OMIM_OS_WINDOWS
@@ -66,16 +67,7 @@ public:
       MYTHROW(OpenException, ("mmap failed for file", fileName));
     }
 
-    int adv = MADV_NORMAL;
-    switch (advice)
-    {
-    case Advice::Random: adv = MADV_RANDOM; break;
-    case Advice::Sequential: adv = MADV_SEQUENTIAL; break;
-    case Advice::Normal: adv = MADV_NORMAL; break;
-    }
-
-    if (madvise(m_memory, static_cast<size_t>(s.st_size), adv) != 0)
-      LOG(LWARNING, ("madvise error:", strerror(errno)));
+    Advise(0, m_size, advice);
 #endif
   }
 
@@ -92,6 +84,31 @@ public:
 #endif
   }
 
+  void Advise(uint64_t offset, uint64_t size, Advice advice) const
+  {
+#ifndef OMIM_OS_WINDOWS
+    if (size == 0)
+      return;
+
+    // madvise requires a page aligned start address.
+    static uint64_t const kPageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    uint64_t const alignedOffset = (offset / kPageSize) * kPageSize;
+    ASSERT_LESS_OR_EQUAL(offset + size, m_size, ());
+
+    int adv = MADV_NORMAL;
+    switch (advice)
+    {
+    case Advice::Random: adv = MADV_RANDOM; break;
+    case Advice::Sequential: adv = MADV_SEQUENTIAL; break;
+    case Advice::WillNeed: adv = MADV_WILLNEED; break;
+    case Advice::Normal: adv = MADV_NORMAL; break;
+    }
+
+    if (madvise(m_memory + alignedOffset, static_cast<size_t>(offset + size - alignedOffset), adv) != 0)
+      LOG(LWARNING, ("madvise error:", strerror(errno)));
+#endif
+  }
+
   uint8_t * m_memory = nullptr;
   uint64_t m_size = 0;
 
@@ -141,6 +158,12 @@ uint8_t * MmapReader::Data() const
   return m_data->m_memory;
 }
 
+void MmapReader::Advise(uint64_t pos, uint64_t size, Advice advice) const
+{
+  ASSERT_LESS_OR_EQUAL(pos + size, Size(), (pos, size));
+  m_data->Advise(m_offset + pos, size, advice);
+}
+
 void MmapReader::SetOffsetAndSize(uint64_t offset, uint64_t size)
 {
   ASSERT_LESS_OR_EQUAL(offset + size, Size(), (offset, size));
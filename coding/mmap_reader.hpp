@@ -15,7 +15,8 @@ public:
   {
     Normal,
     Random,
-    Sequential
+    Sequential,
+    WillNeed
   };
 
   explicit MmapReader(std::string const & fileName, Advice advice = Advice::Normal);
@@ -27,6 +28,10 @@ public:
   /// Direct file/memory access
   uint8_t * Data() const;
 
+  /// Hints the OS about the access pattern for [pos, pos + size) of this reader.
+  /// Does nothing on platforms without madvise.
+  void Advise(uint64_t pos, uint64_t size, Advice advice) const;
+
 protected:
   // Used in special derived readers.
   void SetOffsetAndSize(uint64_t offset, uint64_t size);
@@ -63,8 +63,7 @@ SHA1::Hash SHA1::Calculate(std::string const & filePath)
 // static
 std::string SHA1::CalculateBase64(std::string const & filePath)
 {
-  auto const sha1 = Calculate(filePath);
-  return base64::Encode(std::string_view(reinterpret_cast<char const *>(sha1.data()), sha1.size()));
+  return ToBase64(Calculate(filePath));
 }
 
 // static
@@ -74,4 +73,29 @@ SHA1::Hash SHA1::CalculateForString(std::string_view str)
   sha1.process_bytes(str.data(), str.size());
   return ExtractHash(sha1);
 }
+
+// static
+std::string SHA1::ToBase64(Hash const & hash)
+{
+  return base64::Encode(std::string_view(reinterpret_cast<char const *>(hash.data()), hash.size()));
+}
+
+struct SHA1::Hasher::Impl
+{
+  boost::uuids::detail::sha1 m_sha1;
+};
+
+SHA1::Hasher::Hasher() : m_impl(std::make_unique<Impl>()) {}
+
+SHA1::Hasher::~Hasher() = default;
+
+void SHA1::Hasher::Update(void const * data, size_t size)
+{
+  m_impl->m_sha1.process_bytes(data, size);
+}
+
+SHA1::Hash SHA1::Hasher::Finish()
+{
+  return ExtractHash(m_impl->m_sha1);
+}
 }  // coding
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 
 namespace coding
 {
@@ -16,5 +19,22 @@ public:
   static std::string CalculateBase64(std::string const & filePath);
 
   static Hash CalculateForString(std::string_view str);
+
+  static std::string ToBase64(Hash const & hash);
+
+  /// Calculates hash of data which comes by parts.
+  class Hasher
+  {
+  public:
+    Hasher();
+    ~Hasher();
+
+    void Update(void const * data, size_t size);
+    Hash Finish();
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+  };
 };
 }  // coding
@@ -267,6 +267,51 @@ void const * ReadVarUint64Array(void const * pBeg, void const * pEnd, F f)
   return ::impl::ReadVarInt64Array(pBeg, ::impl::ReadVarInt64ArrayUntilBufferEnd(pEnd), f, base::IdFunctor());
 }
 
+/// The same as ReadVarUint64Array(pBeg, pEnd, f) but faster for long arrays: while there is
+/// enough data for the longest varint, values are decoded by an unrolled loop without
+/// per-byte buffer end checks. Used for long geometry delta arrays.
+template <typename F>
+void const * ReadVarUint64ArrayFast(void const * pBeg, void const * pEnd, F f)
+{
+  // Max size of an encoded uint64_t.
+  ptrdiff_t constexpr kMaxVarUint64Size = 10;
+
+  uint8_t const * p = static_cast<uint8_t const *>(pBeg);
+  uint8_t const * const end = static_cast<uint8_t const *>(pEnd);
+
+  while (end - p >= kMaxVarUint64Size)
+  {
+    uint8_t const * const start = p;
+    uint64_t b = *p++;
+    uint64_t value = b & 127;
+    if (b & 128)
+    {
+      b = *p++;
+      value |= (b & 127) << 7;
+      if (b & 128)
+      {
+        b = *p++;
+        value |= (b & 127) << 14;
+        if (b & 128)
+        {
+          uint32_t shift = 21;
+          do
+          {
+            if (p - start == kMaxVarUint64Size)
+              MYTHROW(ReadVarIntException, ());
+            b = *p++;
+            value |= (b & 127) << shift;
+            shift += 7;
+          } while (b & 128);
+        }
+      }
+    }
+    f(value);
+  }
+
+  return ReadVarUint64Array(p, pEnd, f);
+}
+
 template <typename F>
 void const * ReadVarInt64Array(void const * pBeg, size_t count, F f)
 {
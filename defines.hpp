@@ -85,8 +85,11 @@
 #define SEARCH_BRAND_CATEGORIES_FILE_NAME "categories_brands.txt"
 
 #define PACKED_POLYGONS_INFO_TAG "info"
+#define PACKED_POLYGONS_CELLS_TAG "cells"
 #define PACKED_POLYGONS_FILE "packed_polygons.bin"
 
+#define MWM_REGISTRY_CACHE_FILE "mwm_registry.bin"
+
 #define GPS_TRACK_FILENAME "gps_track.dat"
 #define RESTRICTIONS_FILENAME "restrictions.csv"
 #define ROAD_ACCESS_FILENAME "road_access.bin"
@@ -0,0 +1,48 @@
+#include "testing/benchmark.hpp"
+#include "testing/testing.hpp"
+
+#include "drape/drape_tests/overlay_grid_test_utils.hpp"
+
+#include "base/logging.hpp"
+#include "base/timer.hpp"
+
+#include <random>
+#include <vector>
+
+namespace overlay_grid_benchmark
+{
+using namespace overlay_grid_test_utils;
+
+// Replays the same placing of dense frames on m4::Tree and on OverlayGrid and logs timings.
+BENCHMARK_TEST(OverlayGrid_Placing)
+{
+  std::mt19937 rng(7);
+  m2::RectD const screen(0, 0, 1080, 1920);
+
+  std::vector<std::vector<Overlay>> frames;
+  for (int i = 0; i < 20; ++i)
+    frames.push_back(GenerateFrame(rng, screen, 3000 /* count */));
+
+  double treeTime = 0.0;
+  double gridTime = 0.0;
+  Grid grid;
+  for (auto const & frame : frames)
+  {
+    base::Timer timer;
+    Tree tree;
+    auto const treePlaced = Place(tree, frame);
+    treeTime += timer.ElapsedSeconds();
+
+    timer.Reset();
+    grid.Reset(screen, 64.0 /* cellSize */);
+    GridAdapter adapter{grid};
+    auto const gridPlaced = Place(adapter, frame);
+    gridTime += timer.ElapsedSeconds();
+
+    TEST_EQUAL(treePlaced, gridPlaced, ());
+  }
+
+  LOG(LINFO, ("Overlays placing of", frames.size(), "frames. m4::Tree:", treeTime, "s, OverlayGrid:",
+              gridTime, "s"));
+}
+}  // namespace overlay_grid_benchmark
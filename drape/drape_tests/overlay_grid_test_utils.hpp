@@ -0,0 +1,80 @@
+#pragma once
+
+#include "drape/overlay_grid.hpp"
+
+#include "geometry/rect2d.hpp"
+#include "geometry/tree4d.hpp"
+
+#include "base/assert.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Overlays placing replay shared by overlay_grid_tests and drape_benchmarks.
+namespace overlay_grid_test_utils
+{
+using Grid = dp::OverlayGrid<int>;
+using Tree = m4::Tree<int>;
+
+struct Overlay
+{
+  int m_id;
+  m2::RectD m_rect;
+};
+
+// Frame of labels similar to a dense city center on a phone screen.
+inline std::vector<Overlay> GenerateFrame(std::mt19937 & rng, m2::RectD const & screen, int count)
+{
+  std::uniform_real_distribution<double> x(screen.minX() - 100.0, screen.maxX() + 100.0);
+  std::uniform_real_distribution<double> y(screen.minY() - 100.0, screen.maxY() + 100.0);
+  std::uniform_real_distribution<double> width(20.0, 300.0);
+  std::uniform_real_distribution<double> height(20.0, 60.0);
+
+  std::vector<Overlay> frame;
+  frame.reserve(count);
+  for (int i = 0; i < count; ++i)
+  {
+    m2::PointD const pt(x(rng), y(rng));
+    frame.push_back({i, m2::RectD(pt, pt + m2::PointD(width(rng), height(rng)))});
+  }
+  return frame;
+}
+
+// Replays overlays placing: the overlay is added if there are no intersected overlays or
+// it displaces them otherwise (every second time). Returns ids of placed overlays.
+template <typename Index>
+std::vector<int> Place(Index & index, std::vector<Overlay> const & frame)
+{
+  std::vector<int> placed;
+  std::vector<int> rivals;
+  for (auto const & overlay : frame)
+  {
+    rivals.clear();
+    index.ForEachInRect(overlay.m_rect, [&rivals](int id) { rivals.push_back(id); });
+    if (!rivals.empty() && overlay.m_id % 2 == 0)
+      continue;
+
+    for (int const id : rivals)
+    {
+      index.Erase(id, frame[id].m_rect);
+      placed.erase(std::find(placed.begin(), placed.end(), id));
+    }
+    index.Add(overlay.m_id, overlay.m_rect);
+    placed.push_back(overlay.m_id);
+  }
+  std::sort(placed.begin(), placed.end());
+  return placed;
+}
+
+// Adapts OverlayGrid interface to the m4::Tree one for Place().
+struct GridAdapter
+{
+  template <typename ToDo>
+  void ForEachInRect(m2::RectD const & rect, ToDo && toDo) const { m_grid.ForEachInRect(rect, toDo); }
+  void Add(int id, m2::RectD const & rect) { m_grid.Add(id, rect); }
+  void Erase(int id, m2::RectD const &) { CHECK(m_grid.Erase(id), (id)); }
+
+  Grid & m_grid;
+};
+}  // namespace overlay_grid_test_utils
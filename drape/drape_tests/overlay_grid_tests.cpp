@@ -0,0 +1,109 @@
+#include "testing/testing.hpp"
+
+#include "drape/drape_tests/overlay_grid_test_utils.hpp"
+
+#include "drape/overlay_grid.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace overlay_grid_tests
+{
+using namespace overlay_grid_test_utils;
+
+std::vector<int> Select(Grid const & grid, m2::RectD const & rect)
+{
+  std::vector<int> result;
+  grid.ForEachInRect(rect, [&result](int id) { result.push_back(id); });
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+std::vector<int> Select(Tree const & tree, m2::RectD const & rect)
+{
+  std::vector<int> result;
+  tree.ForEachInRect(rect, [&result](int id) { result.push_back(id); });
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+UNIT_TEST(OverlayGrid_Smoke)
+{
+  Grid grid;
+  grid.Reset(m2::RectD(0, 0, 100, 100), 10.0 /* cellSize */);
+  TEST(grid.IsEmpty(), ());
+
+  grid.Add(1, m2::RectD(5, 5, 15, 15));
+  grid.Add(2, m2::RectD(50, 50, 95, 95));
+  // Objects out of the grid bounds are stored in the border cells.
+  grid.Add(3, m2::RectD(-50, -50, -10, -10));
+  grid.Add(4, m2::RectD(90, 90, 200, 200));
+  TEST_EQUAL(grid.GetSize(), 4, ());
+
+  TEST_EQUAL(Select(grid, m2::RectD(0, 0, 100, 100)), std::vector<int>({1, 2, 4}), ());
+  TEST_EQUAL(Select(grid, m2::RectD(10, 10, 10, 10)), std::vector<int>({1}), ());
+  TEST_EQUAL(Select(grid, m2::RectD(-30, -30, -20, -20)), std::vector<int>({3}), ());
+  TEST_EQUAL(Select(grid, m2::RectD(150, 150, 160, 160)), std::vector<int>({4}), ());
+  // Touching rects don't intersect.
+  TEST_EQUAL(Select(grid, m2::RectD(15, 15, 20, 20)), std::vector<int>(), ());
+
+  TEST(grid.Erase(1), ());
+  TEST(!grid.Erase(1), ());
+  TEST_EQUAL(Select(grid, m2::RectD(0, 0, 100, 100)), std::vector<int>({2, 4}), ());
+
+  // Adding of the same object replaces its rect.
+  grid.Add(2, m2::RectD(5, 5, 15, 15));
+  TEST_EQUAL(grid.GetSize(), 3, ());
+  TEST_EQUAL(Select(grid, m2::RectD(40, 40, 60, 60)), std::vector<int>(), ());
+  TEST_EQUAL(Select(grid, m2::RectD(0, 0, 10, 10)), std::vector<int>({2}), ());
+
+  grid.Reset(m2::RectD(0, 0, 200, 200), 20.0 /* cellSize */);
+  TEST(grid.IsEmpty(), ());
+  TEST_EQUAL(Select(grid, m2::RectD(0, 0, 200, 200)), std::vector<int>(), ());
+}
+
+UNIT_TEST(OverlayGrid_SameAsTree)
+{
+  std::mt19937 rng(42);
+  m2::RectD const screen(0, 0, 1080, 1920);
+
+  Grid grid;
+  for (int frameIndex = 0; frameIndex < 5; ++frameIndex)
+  {
+    auto const frame = GenerateFrame(rng, screen, 1000 /* count */);
+
+    Tree tree;
+    grid.Reset(screen, 64.0 /* cellSize */);
+    for (auto const & overlay : frame)
+    {
+      tree.Add(overlay.m_id, overlay.m_rect);
+      grid.Add(overlay.m_id, overlay.m_rect);
+    }
+
+    for (auto const & overlay : frame)
+      TEST_EQUAL(Select(grid, overlay.m_rect), Select(tree, overlay.m_rect), (overlay.m_rect));
+  }
+}
+
+// Replays the same placing on m4::Tree and on OverlayGrid and checks that results are equal.
+// Timings are measured by OverlayGrid_Placing in drape_benchmarks.
+UNIT_TEST(OverlayGrid_PlacingSameAsTree)
+{
+  std::mt19937 rng(7);
+  m2::RectD const screen(0, 0, 1080, 1920);
+
+  Grid grid;
+  for (int i = 0; i < 2; ++i)
+  {
+    auto const frame = GenerateFrame(rng, screen, 300 /* count */);
+
+    Tree tree;
+    auto const treePlaced = Place(tree, frame);
+
+    grid.Reset(screen, 64.0 /* cellSize */);
+    GridAdapter adapter{grid};
+    TEST_EQUAL(treePlaced, Place(adapter, frame), ());
+  }
+}
+}  // namespace overlay_grid_tests
@@ -0,0 +1,77 @@
+#include "testing/testing.hpp"
+
+#include "drape/shaped_text_cache.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+UNIT_TEST(ShapedTextCache_Smoke)
+{
+  dp::ShapedTextCache<int> cache(100 /* maxSize */);
+
+  int value = 0;
+  TEST(!cache.Find("Main street", 20 /* fontPixelHeight */, 1 /* lang */, value), ());
+
+  cache.Insert("Main street", 20, 1, 42);
+  TEST(cache.Find("Main street", 20, 1, value), ());
+  TEST_EQUAL(value, 42, ());
+
+  // Font height and language are parts of the key.
+  TEST(!cache.Find("Main street", 22, 1, value), ());
+  TEST(!cache.Find("Main street", 20, 2, value), ());
+
+  auto const stats = cache.GetStats();
+  TEST_EQUAL(stats.m_hits, 1, (stats));
+  TEST_EQUAL(stats.m_misses, 3, (stats));
+  TEST_EQUAL(stats.m_evictions, 0, (stats));
+
+  cache.Clear();
+  TEST_EQUAL(cache.GetSize(), 0, ());
+}
+
+UNIT_TEST(ShapedTextCache_Eviction)
+{
+  size_t constexpr kMaxSize = 64;
+  dp::ShapedTextCache<int> cache(kMaxSize);
+
+  int constexpr kCount = 1000;
+  for (int i = 0; i < kCount; ++i)
+    cache.Insert(std::to_string(i), 20, 1, i);
+
+  TEST_LESS_OR_EQUAL(cache.GetSize(), kMaxSize, ());
+  TEST_EQUAL(cache.GetStats().m_evictions, kCount - cache.GetSize(), ());
+
+  // The most recently inserted text is never evicted.
+  int value = 0;
+  TEST(cache.Find(std::to_string(kCount - 1), 20, 1, value), ());
+  TEST_EQUAL(value, kCount - 1, ());
+}
+
+UNIT_TEST(ShapedTextCache_Concurrent)
+{
+  dp::ShapedTextCache<int> cache(1000 /* maxSize */);
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 8; ++i)
+  {
+    threads.emplace_back([&cache]()
+    {
+      for (int j = 0; j < 10000; ++j)
+      {
+        int const k = j % 100;
+        int value = 0;
+        if (cache.Find(std::to_string(k), 20, 1, value))
+          TEST_EQUAL(value, k, ());
+        else
+          cache.Insert(std::to_string(k), 20, 1, k);
+      }
+    });
+  }
+
+  for (auto & t : threads)
+    t.join();
+
+  auto const stats = cache.GetStats();
+  TEST_EQUAL(stats.m_hits + stats.m_misses, 8 * 10000, (stats));
+}
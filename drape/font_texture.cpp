@@ -1,6 +1,7 @@
 #include "drape/font_texture.hpp"
 
 #include "drape/pointers.hpp"
+#include "drape/utils/texture_upload_tracker.hpp"
 
 #include "base/logging.hpp"
 
@@ -210,6 +211,8 @@ void GlyphIndex::UploadResources(ref_ptr<GraphicsContext> context, ref_ptr<Textu
     m2::PointU const zeroPoint = rect.LeftBottom();
     uint8_t * srcMemory = SharedBufferManager::GetRawPointer(glyph.m_image.m_data);
     texture->UploadData(context, zeroPoint.x, zeroPoint.y, rect.SizeX(), rect.SizeY(), make_ref(srcMemory));
+    TextureUploadTracker::Instance().AddGlyphUpload(static_cast<uint64_t>(rect.SizeX()) * rect.SizeY() *
+                                                    GetBytesPerPixel(texture->GetFormat()));
 
     glyph.m_image.Destroy();
   }
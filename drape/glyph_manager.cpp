@@ -19,6 +19,7 @@
 #include <ft2build.h>
 #include <hb-ft.h>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unicode/unistr.h>
@@ -353,11 +354,13 @@ struct GlyphManager::Impl
   TUniBlockIter m_lastUsedBlock;
   std::vector<std::unique_ptr<Font>> m_fonts;
 
-  // Required to use std::string_view as a search key for std::unordered_map::find().
-  struct StringHash : public std::hash<std::string_view> { using is_transparent = void; };
+  // Empirically measured, may need more tuning.
+  static size_t constexpr kMaxShapedTextCacheSize = 50000;
+  ShapedTextCache<text::TextMetrics> m_shapedTextCache{kMaxShapedTextCacheSize};
 
-  // TODO(AB): Compare performance with std::map.
-  std::unordered_map<std::string, text::TextMetrics, StringHash, std::equal_to<>> m_textMetricsCache;
+  // Guards HarfBuzz buffer, |m_lastUsedBlock| and FreeType faces. Faces are shared by shaping and
+  // glyphs rasterization (both set the face pixel size), so GetGlyphImage() takes it too.
+  std::mutex m_shapingMutex;
   hb_buffer_t * m_harfbuzzBuffer;
 };
 
@@ -604,6 +607,7 @@ bool GlyphManager::AreGlyphsReady(TGlyphs const & glyphs) const
 // TODO(AB): Check and support invalid glyphs.
 GlyphImage GlyphManager::GetGlyphImage(GlyphFontAndId key, int pixelHeight, bool sdf) const
 {
+  std::lock_guard lock(m_impl->m_shapingMutex);
   return m_impl->m_fonts[key.m_fontIndex]->GetGlyphImage(key.m_glyphId, pixelHeight, sdf);
 }
 
@@ -620,28 +624,24 @@ hb_language_t OrganicMapsLanguageToHarfbuzzLanguage(int8_t lang)
 }
 }  // namespace
 
-// This method is NOT multithreading-safe.
+// This method is thread-safe. Cached results are returned concurrently, shaping itself is serialized.
 text::TextMetrics GlyphManager::ShapeText(std::string_view utf8, int fontPixelHeight, int8_t lang)
 {
-#ifdef DEBUG
-  static int const fontSize = fontPixelHeight;
-  ASSERT_EQUAL(fontSize, fontPixelHeight,
-      ("Cache relies on the same font height/metrics for each glyph", fontSize, fontPixelHeight));
-#endif
+  text::TextMetrics allGlyphs;
 
   // A simple cache greatly speeds up text metrics calculation. It has 80+% hit ratio in most scenarios.
-  if (auto const found = m_impl->m_textMetricsCache.find(utf8); found != m_impl->m_textMetricsCache.end())
-    return found->second;
+  if (m_impl->m_shapedTextCache.Find(utf8, fontPixelHeight, lang, allGlyphs))
+    return allGlyphs;
 
   const auto [text, segments] = harfbuzz_shaping::GetTextSegments(utf8);
 
   // TODO(AB): Optimize language conversion.
   hb_language_t const hbLanguage = OrganicMapsLanguageToHarfbuzzLanguage(lang);
 
-  text::TextMetrics allGlyphs;
   // TODO(AB): Check if it's slower or faster.
   allGlyphs.m_glyphs.reserve(icu::UnicodeString{false, text.data(), static_cast<int32_t>(text.size())}.countChar32());
 
+  std::unique_lock lock(m_impl->m_shapingMutex);
   for (auto const & substring : segments)
   {
     hb_buffer_clear_contents(m_impl->m_harfbuzzBuffer);
@@ -671,19 +671,12 @@ text::TextMetrics GlyphManager::ShapeText(std::string_view utf8, int fontPixelHe
     } while (u32CharacterIter != end);
   }
 
+  lock.unlock();
+
   if (allGlyphs.m_glyphs.empty())
     LOG(LWARNING, ("No glyphs were found in all fonts for string", utf8));
 
-  // Empirically measured, may need more tuning.
-  size_t constexpr kMaxCacheSize = 50000;
-  if (m_impl->m_textMetricsCache.size() > kMaxCacheSize)
-  {
-    LOG(LINFO, ("Clearing text metrics cache"));
-    // TODO(AB): Is there a better way? E.g. clear a half of the cache?
-    m_impl->m_textMetricsCache.clear();
-  }
-  
-  m_impl->m_textMetricsCache.emplace(utf8, allGlyphs);
+  m_impl->m_shapedTextCache.Insert(utf8, fontPixelHeight, lang, allGlyphs);
 
   return allGlyphs;
 }
@@ -693,4 +686,9 @@ text::TextMetrics GlyphManager::ShapeText(std::string_view utf8, int fontPixelHe
   return ShapeText(utf8, fontPixelHeight, StringUtf8Multilang::GetLangIndex(lang));
 }
 
+ShapedTextCacheStats GlyphManager::GetShapedTextCacheStats() const
+{
+  return m_impl->m_shapedTextCache.GetStats();
+}
+
 }  // namespace dp
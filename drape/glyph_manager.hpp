@@ -1,6 +1,7 @@
 #pragma once
 
 #include "drape/glyph.hpp"
+#include "drape/shaped_text_cache.hpp"
 
 #include "base/string_utils.hpp"
 
@@ -76,6 +77,8 @@ public:
   text::TextMetrics ShapeText(std::string_view utf8, int fontPixelHeight, int8_t lang);
   text::TextMetrics ShapeText(std::string_view utf8, int fontPixelHeight, char const * lang);
 
+  ShapedTextCacheStats GetShapedTextCacheStats() const;
+
   GlyphImage GetGlyphImage(GlyphFontAndId key, int pixelHeight, bool sdf) const;
 
 private:
@@ -0,0 +1,178 @@
+#pragma once
+
+#include "geometry/rect2d.hpp"
+
+#include "base/assert.hpp"
+#include "base/math.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace dp
+{
+/// Uniform grid spatial index for screen space rects. Overlays are small and densely
+/// distributed over the screen, so a grid with cells of an average label size answers
+/// intersection queries faster than a general purpose tree, and it's cheap to rebuild
+/// every frame: cells' and items' memory is reused after Reset().
+/// Rects are intersected in the same way as in m4::Tree (touching rects don't intersect).
+/// Rects outside of the grid bounds are clamped to the border cells.
+template <typename T, typename Hasher = std::hash<T>>
+class OverlayGrid
+{
+public:
+  OverlayGrid() { Reset(m2::RectD(0.0, 0.0, 1.0, 1.0), 1.0 /* cellSize */); }
+
+  /// Removes all objects and covers |bounds| with cells of |cellSize| x |cellSize|.
+  void Reset(m2::RectD const & bounds, double cellSize)
+  {
+    ASSERT_GREATER(cellSize, 0.0, ());
+    Clear();
+
+    m_bounds = bounds;
+    // Too small cells are enlarged to not waste memory on huge (perspective) screens.
+    m_cellSize = std::max(cellSize, std::max(bounds.SizeX(), bounds.SizeY()) / kMaxCellsPerSide);
+    m_cellsX = std::max(1, static_cast<int>(std::ceil(bounds.SizeX() / m_cellSize)));
+    m_cellsY = std::max(1, static_cast<int>(std::ceil(bounds.SizeY() / m_cellSize)));
+    m_cells.resize(static_cast<size_t>(m_cellsX) * m_cellsY);
+  }
+
+  void Clear()
+  {
+    for (auto & cell : m_cells)
+      cell.clear();
+    m_items.clear();
+    m_freeItems.clear();
+    m_index.clear();
+  }
+
+  /// Replaces the rect of |obj| if it's already in the grid.
+  void Add(T const & obj, m2::RectD const & rect)
+  {
+    Erase(obj);
+
+    uint32_t itemIndex;
+    if (m_freeItems.empty())
+    {
+      itemIndex = static_cast<uint32_t>(m_items.size());
+      m_items.emplace_back();
+    }
+    else
+    {
+      itemIndex = m_freeItems.back();
+      m_freeItems.pop_back();
+    }
+
+    Item & item = m_items[itemIndex];
+    item.m_obj = obj;
+    item.m_rect = rect;
+    item.m_queryId = 0;
+    m_index.emplace(obj, itemIndex);
+
+    ForEachCell(*this, m_cells, rect, [itemIndex](std::vector<uint32_t> & cell) { cell.push_back(itemIndex); });
+  }
+
+  /// \returns false if there is no |obj| in the grid.
+  bool Erase(T const & obj)
+  {
+    auto const it = m_index.find(obj);
+    if (it == m_index.end())
+      return false;
+
+    uint32_t const itemIndex = it->second;
+    m_index.erase(it);
+
+    ForEachCell(*this, m_cells, m_items[itemIndex].m_rect, [itemIndex](std::vector<uint32_t> & cell)
+    {
+      auto const cellIt = std::find(cell.begin(), cell.end(), itemIndex);
+      ASSERT(cellIt != cell.end(), ());
+      *cellIt = cell.back();
+      cell.pop_back();
+    });
+
+    m_items[itemIndex].m_obj = T();
+    m_freeItems.push_back(itemIndex);
+    return true;
+  }
+
+  template <typename ToDo>
+  void ForEachInRect(m2::RectD const & rect, ToDo && toDo) const
+  {
+    // An object which covers several cells must be reported once.
+    if (++m_queryId == 0)
+    {
+      for (auto & item : m_items)
+        item.m_queryId = 0;
+      m_queryId = 1;
+    }
+
+    ForEachCell(*this, m_cells, rect, [&](std::vector<uint32_t> const & cell)
+    {
+      for (auto const itemIndex : cell)
+      {
+        Item const & item = m_items[itemIndex];
+        if (item.m_queryId == m_queryId)
+          continue;
+
+        item.m_queryId = m_queryId;
+        if (IsIntersect(item.m_rect, rect))
+          toDo(item.m_obj);
+      }
+    });
+  }
+
+  bool IsEmpty() const { return m_index.empty(); }
+  size_t GetSize() const { return m_index.size(); }
+
+private:
+  struct Item
+  {
+    T m_obj = T();
+    m2::RectD m_rect;
+    mutable uint32_t m_queryId = 0;
+  };
+
+  static int constexpr kMaxCellsPerSide = 128;
+
+  static bool IsIntersect(m2::RectD const & r1, m2::RectD const & r2)
+  {
+    return !(r1.maxX() <= r2.minX() || r1.minX() >= r2.maxX() ||
+             r1.maxY() <= r2.minY() || r1.minY() >= r2.maxY());
+  }
+
+  int GetCell(double v, double minV, int cellsCount) const
+  {
+    double const cell = base::Clamp((v - minV) / m_cellSize, 0.0, static_cast<double>(cellsCount - 1));
+    return static_cast<int>(cell);
+  }
+
+  template <typename Cells, typename ToDo>
+  static void ForEachCell(OverlayGrid const & grid, Cells & cells, m2::RectD const & rect, ToDo && toDo)
+  {
+    int const minX = grid.GetCell(rect.minX(), grid.m_bounds.minX(), grid.m_cellsX);
+    int const maxX = grid.GetCell(rect.maxX(), grid.m_bounds.minX(), grid.m_cellsX);
+    int const minY = grid.GetCell(rect.minY(), grid.m_bounds.minY(), grid.m_cellsY);
+    int const maxY = grid.GetCell(rect.maxY(), grid.m_bounds.minY(), grid.m_cellsY);
+    for (int y = minY; y <= maxY; ++y)
+    {
+      for (int x = minX; x <= maxX; ++x)
+        toDo(cells[static_cast<size_t>(y) * grid.m_cellsX + x]);
+    }
+  }
+
+  m2::RectD m_bounds;
+  double m_cellSize = 1.0;
+  int m_cellsX = 1;
+  int m_cellsY = 1;
+
+  std::vector<std::vector<uint32_t>> m_cells;
+  std::vector<Item> m_items;
+  std::vector<uint32_t> m_freeItems;
+  std::unordered_map<T, uint32_t, Hasher> m_index;
+
+  mutable uint32_t m_queryId = 0;
+};
+}  // namespace dp
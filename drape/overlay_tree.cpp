@@ -15,6 +15,8 @@ uint32_t const kMaxHandlesCount = 1000;
 
 size_t const kAverageHandlesCount[dp::OverlayRanksCount] = { 300, 200, 50 };
 int const kInvalidFrame = -1;
+// Size of the overlays grid cell in pixels (before visual scale), it's about the size of a label.
+double const kGridCellSize = 64.0;
 
 namespace
 {
@@ -94,7 +96,7 @@ void OverlayTree::SetVisualScale(double visualScale)
 void OverlayTree::Clear()
 {
   InvalidateOnNextFrame();
-  TBase::Clear();
+  m_grid.Clear();
   m_handlesCache.clear();
   m_overlayIdCache.clear();
   for (auto & handles : m_handles)
@@ -139,10 +141,10 @@ void OverlayTree::InvalidateOnNextFrame()
 void OverlayTree::StartOverlayPlacing(ScreenBase const & screen, uint8_t zoomLevel)
 {
   ASSERT(IsNeedUpdate(), ());
-  TBase::Clear();
   m_handlesCache.clear();
   m_overlayIdCache.clear();
   m_traits.SetModelView(screen);
+  m_grid.Reset(m_traits.GetExtendedScreenRect(), kGridCellSize * m_traits.GetVisualScale());
   m_displacementInfo.clear();
   m_zoomLevel = zoomLevel;
 }
@@ -151,7 +153,7 @@ bool OverlayTree::Remove(ref_ptr<OverlayHandle> handle)
 {
   if (m_frameCounter == kInvalidFrame)
   {
-    if (!IsEmpty())
+    if (!m_grid.IsEmpty())
       Clear();
     return true;
   }
@@ -233,7 +235,7 @@ void OverlayTree::InsertHandle(ref_ptr<OverlayHandle> handle, int currentRank,
   {
     m_handlesCache.insert(handle);
     m_overlayIdCache[handle->GetOverlayID()].push_back(handle);
-    TBase::Add(handle, pixelRect);
+    m_grid.Add(handle, pixelRect);
     return;
   }
 
@@ -242,7 +244,7 @@ void OverlayTree::InsertHandle(ref_ptr<OverlayHandle> handle, int currentRank,
 
   // Find elements that already on OverlayTree and it's pixel rect
   // intersect with handle pixel rect ("Intersected elements").
-  ForEachInRect(pixelRect, [&] (ref_ptr<OverlayHandle> const & h)
+  m_grid.ForEachInRect(pixelRect, [&] (ref_ptr<OverlayHandle> const & h)
   {
     bool const isParent = (h == parentOverlay) ||
                           (h->GetOverlayID() == handle->GetOverlayID() &&
@@ -328,7 +330,7 @@ void OverlayTree::InsertHandle(ref_ptr<OverlayHandle> handle, int currentRank,
 
   m_handlesCache.insert(handle);
   m_overlayIdCache[handle->GetOverlayID()].push_back(handle);
-  TBase::Add(handle, pixelRect);
+  m_grid.Add(handle, pixelRect);
 }
 
 void OverlayTree::EndOverlayPlacing()
@@ -405,7 +407,7 @@ bool OverlayTree::DeleteHandleImpl(ref_ptr<OverlayHandle> handle)
 {
   if (m_handlesCache.erase(handle) > 0)
   {
-    Erase(handle);
+    m_grid.Erase(handle);
     return true;
   }
   return false;
@@ -491,7 +493,7 @@ void OverlayTree::Select(m2::PointD const & glbPoint, TOverlayContainer & result
 void OverlayTree::Select(m2::RectD const & rect, TOverlayContainer & result) const
 {
   ScreenBase screen = GetModelView();
-  ForEachInRect(rect, [&](ref_ptr<OverlayHandle> const & h)
+  m_grid.ForEachInRect(rect, [&](ref_ptr<OverlayHandle> const & h)
   {
     ASSERT(h->GetOverlayID().IsValid(), ());
 
@@ -1,10 +1,10 @@
 #pragma once
 
 #include "drape/drape_diagnostics.hpp"
+#include "drape/overlay_grid.hpp"
 #include "drape/overlay_handle.hpp"
 
 #include "geometry/screenbase.hpp"
-#include "geometry/tree4d.hpp"
 
 #include "base/buffer_vector.hpp"
 
@@ -25,6 +25,7 @@ public:
     return handle->GetExtendedPixelRect(m_modelView);
   }
   ScreenBase const & GetModelView() const { return m_modelView; }
+  double GetVisualScale() const { return m_visualScale; }
   m2::RectD const & GetExtendedScreenRect() const { return m_extendedScreenRect; }
   m2::RectD const & GetDisplacersFreeRect() const { return m_displacersFreeRect; }
 
@@ -53,10 +54,8 @@ class DebugRenderer;
 
 using TOverlayContainer = buffer_vector<ref_ptr<OverlayHandle>, 8>;
 
-class OverlayTree : public m4::Tree<ref_ptr<OverlayHandle>, detail::OverlayTraits>
+class OverlayTree
 {
-  using TBase = m4::Tree<ref_ptr<OverlayHandle>, detail::OverlayTraits>;
-
 public:
   using HandlesCache = std::unordered_set<ref_ptr<OverlayHandle>, detail::OverlayHasher>;
 
@@ -117,6 +116,10 @@ private:
 
   bool IsInCache(ref_ptr<OverlayHandle> const & handle) const;
 
+  detail::OverlayTraits m_traits;
+  // Screen space index of placed handles, it's rebuilt on every overlays placing.
+  OverlayGrid<ref_ptr<OverlayHandle>, detail::OverlayHasher> m_grid;
+
   int m_frameCounter;
   std::array<std::vector<ref_ptr<OverlayHandle>>, dp::OverlayRanksCount> m_handles;
 
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "base/assert.hpp"
+#include "base/macros.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace dp
+{
+struct ShapedTextCacheStats
+{
+  uint64_t m_hits = 0;
+  uint64_t m_misses = 0;
+  uint64_t m_evictions = 0;
+};
+
+inline std::string DebugPrint(ShapedTextCacheStats const & stats)
+{
+  std::ostringstream out;
+  out << "ShapedTextCacheStats [ hits: " << stats.m_hits << ", misses: " << stats.m_misses
+      << ", evictions: " << stats.m_evictions << " ]";
+  return out.str();
+}
+
+/// Thread-safe size-bounded (LRU) cache of text shaping results keyed by
+/// (text, font pixel height, language). It's split into shards with separate locks,
+/// so readers from different threads rarely wait for each other.
+template <typename Value>
+class ShapedTextCache
+{
+public:
+  /// \param maxSize Maximum number of cached texts. It should be one or greater.
+  explicit ShapedTextCache(size_t maxSize)
+    : m_maxShardSize(std::max(size_t(1), (maxSize + kShardsCount - 1) / kShardsCount))
+  {
+    CHECK_GREATER(maxSize, 0, ());
+  }
+
+  /// \returns true and copies the cached shaping result to |value| if it's found.
+  bool Find(std::string_view text, int fontPixelHeight, int8_t lang, Value & value)
+  {
+    KeyView const key{text, fontPixelHeight, lang};
+    Shard & shard = GetShard(key);
+
+    std::lock_guard lock(shard.m_mutex);
+    auto const it = shard.m_index.find(key);
+    if (it == shard.m_index.end())
+    {
+      ++m_misses;
+      return false;
+    }
+
+    ++m_hits;
+    shard.m_entries.splice(shard.m_entries.begin(), shard.m_entries, it->second);
+    value = it->second->m_value;
+    return true;
+  }
+
+  void Insert(std::string_view text, int fontPixelHeight, int8_t lang, Value const & value)
+  {
+    KeyView const key{text, fontPixelHeight, lang};
+    Shard & shard = GetShard(key);
+
+    std::lock_guard lock(shard.m_mutex);
+    // The same text may be shaped concurrently by several threads.
+    if (shard.m_index.find(key) != shard.m_index.end())
+      return;
+
+    auto & entry = shard.m_entries.emplace_front(Entry{std::string(text), fontPixelHeight, lang, value});
+    // The key references the text owned by the entry.
+    shard.m_index.emplace(KeyView{entry.m_text, fontPixelHeight, lang}, shard.m_entries.begin());
+
+    if (shard.m_entries.size() > m_maxShardSize)
+    {
+      auto const & lru = shard.m_entries.back();
+      shard.m_index.erase(KeyView{lru.m_text, lru.m_fontPixelHeight, lru.m_lang});
+      shard.m_entries.pop_back();
+      ++m_evictions;
+    }
+  }
+
+  void Clear()
+  {
+    for (auto & shard : m_shards)
+    {
+      std::lock_guard lock(shard.m_mutex);
+      shard.m_index.clear();
+      shard.m_entries.clear();
+    }
+  }
+
+  size_t GetSize() const
+  {
+    size_t size = 0;
+    for (auto & shard : m_shards)
+    {
+      std::lock_guard lock(shard.m_mutex);
+      size += shard.m_entries.size();
+    }
+    return size;
+  }
+
+  ShapedTextCacheStats GetStats() const
+  {
+    ShapedTextCacheStats stats;
+    stats.m_hits = m_hits;
+    stats.m_misses = m_misses;
+    stats.m_evictions = m_evictions;
+    return stats;
+  }
+
+private:
+  struct KeyView
+  {
+    bool operator==(KeyView const & rhs) const
+    {
+      return m_fontPixelHeight == rhs.m_fontPixelHeight && m_lang == rhs.m_lang && m_text == rhs.m_text;
+    }
+
+    std::string_view m_text;
+    int m_fontPixelHeight;
+    int8_t m_lang;
+  };
+
+  struct KeyViewHash
+  {
+    size_t operator()(KeyView const & key) const
+    {
+      size_t const h = std::hash<std::string_view>()(key.m_text);
+      return h ^ (static_cast<size_t>(key.m_fontPixelHeight) * 31 + static_cast<uint8_t>(key.m_lang)) * 0x9E3779B9;
+    }
+  };
+
+  struct Entry
+  {
+    std::string m_text;
+    int m_fontPixelHeight;
+    int8_t m_lang;
+    Value m_value;
+  };
+
+  using Entries = std::list<Entry>;
+
+  struct Shard
+  {
+    std::mutex m_mutex;
+    // Most recently used entries are at the front.
+    Entries m_entries;
+    std::unordered_map<KeyView, typename Entries::iterator, KeyViewHash> m_index;
+  };
+
+  static size_t constexpr kShardsCount = 16;
+
+  Shard & GetShard(KeyView const & key)
+  {
+    // High bits are used to not correlate with the buckets of the shard's index.
+    return m_shards[(KeyViewHash()(key) >> 16) % kShardsCount];
+  }
+
+  size_t const m_maxShardSize;
+  mutable std::array<Shard, kShardsCount> m_shards;
+
+  std::atomic<uint64_t> m_hits{0};
+  std::atomic<uint64_t> m_misses{0};
+  std::atomic<uint64_t> m_evictions{0};
+
+  DISALLOW_COPY_AND_MOVE(ShapedTextCache);
+};
+}  // namespace dp
@@ -1,5 +1,7 @@
 #include "drape/texture.hpp"
 
+#include "drape/utils/texture_upload_tracker.hpp"
+
 #include <glm/gtc/round.hpp>  // glm::isPowerOfTwo
 
 namespace dp
@@ -25,6 +27,8 @@ void Texture::UploadData(ref_ptr<dp::GraphicsContext> context, uint32_t x, uint3
 {
   ASSERT(m_hwTexture != nullptr, ());
   m_hwTexture->UploadData(context, x, y, width, height, data);
+  TextureUploadTracker::Instance().AddTextureUpload(static_cast<uint64_t>(width) * height *
+                                                    GetBytesPerPixel(m_hwTexture->GetFormat()));
 }
 
 TextureFormat Texture::GetFormat() const
@@ -491,12 +491,13 @@ text::TextMetrics TextureManager::ShapeSingleTextLine(float fontPixelHeight, std
   std::vector<ref_ptr<Texture::ResourceInfo>> resourcesInfo;
   bool hasNewResources = false;
 
-  // TODO(AB): Is this mutex too slow?
-  std::lock_guard lock(m_calcGlyphsMutex);
-
+  // Shaping is thread-safe and doesn't need the glyph groups lock.
   // TODO(AB): Fix hard-coded lang.
   auto textMetrics = m_glyphManager->ShapeText(utf8, fontPixelHeight, "en");
 
+  // TODO(AB): Is this mutex too slow?
+  std::lock_guard lock(m_calcGlyphsMutex);
+
   auto const & glyphs = textMetrics.m_glyphs;
 
   size_t const hybridGroupIndex = FindHybridGlyphsGroup(glyphs);
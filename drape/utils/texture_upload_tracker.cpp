@@ -0,0 +1,32 @@
+#include "drape/utils/texture_upload_tracker.hpp"
+
+namespace dp
+{
+TextureUploadTracker & TextureUploadTracker::Instance()
+{
+  static TextureUploadTracker s_inst;
+  return s_inst;
+}
+
+void TextureUploadTracker::AddTextureUpload(uint64_t bytes)
+{
+  m_textureUploadsCount.fetch_add(1, std::memory_order_relaxed);
+  m_textureUploadedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void TextureUploadTracker::AddGlyphUpload(uint64_t bytes)
+{
+  m_glyphsCount.fetch_add(1, std::memory_order_relaxed);
+  m_glyphsUploadedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+TextureUploadTracker::Snapshot TextureUploadTracker::GetSnapshot() const
+{
+  Snapshot snapshot;
+  snapshot.m_textureUploadsCount = m_textureUploadsCount.load(std::memory_order_relaxed);
+  snapshot.m_textureUploadedBytes = m_textureUploadedBytes.load(std::memory_order_relaxed);
+  snapshot.m_glyphsCount = m_glyphsCount.load(std::memory_order_relaxed);
+  snapshot.m_glyphsUploadedBytes = m_glyphsUploadedBytes.load(std::memory_order_relaxed);
+  return snapshot;
+}
+}  // namespace dp
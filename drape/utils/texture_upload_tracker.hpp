@@ -0,0 +1,41 @@
+#pragma once
+
+#include "base/macros.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace dp
+{
+/// Counts data uploaded to textures (dynamic textures are updated every frame when
+/// new glyphs, colors or stipple pens appear). Counters are cheap atomics, so they
+/// are always on; consumers calculate volumes of a period by snapshots difference.
+class TextureUploadTracker
+{
+public:
+  struct Snapshot
+  {
+    uint64_t m_textureUploadsCount = 0;
+    uint64_t m_textureUploadedBytes = 0;
+    uint64_t m_glyphsCount = 0;
+    uint64_t m_glyphsUploadedBytes = 0;
+  };
+
+  static TextureUploadTracker & Instance();
+
+  void AddTextureUpload(uint64_t bytes);
+  void AddGlyphUpload(uint64_t bytes);
+
+  Snapshot GetSnapshot() const;
+
+private:
+  TextureUploadTracker() = default;
+
+  std::atomic<uint64_t> m_textureUploadsCount{0};
+  std::atomic<uint64_t> m_textureUploadedBytes{0};
+  std::atomic<uint64_t> m_glyphsCount{0};
+  std::atomic<uint64_t> m_glyphsUploadedBytes{0};
+
+  DISALLOW_COPY_AND_MOVE(TextureUploadTracker);
+};
+}  // namespace dp
@@ -1,6 +1,7 @@
 #include "drape_frontend/apply_feature_functors.hpp"
 
 #include "drape_frontend/area_shape.hpp"
+#include "drape_frontend/buildings_geometry_cache.hpp"
 #include "drape_frontend/color_constants.hpp"
 #include "drape_frontend/colored_symbol_shape.hpp"
 #include "drape_frontend/line_shape.hpp"
@@ -547,6 +548,7 @@ ApplyAreaFeature::ApplyAreaFeature(TileKey const & tileKey, TInsertShapeFn const
 
 void ApplyAreaFeature::operator()(m2::PointD const & p1, m2::PointD const & p2, m2::PointD const & p3)
 {
+  ASSERT(m_buildingGeometry == nullptr, ());
   if (m_isBuilding)
   {
     /// @todo I suppose that we don't intersect triangles with tile rect because of _simple_
@@ -585,6 +587,33 @@ void ApplyAreaFeature::operator()(m2::PointD const & p1, m2::PointD const & p2,
     m2::ClipTriangleByRect(m_tileRect, p1, p3, p2, clipFunctor);
 }
 
+bool ApplyAreaFeature::HasGeometry() const
+{
+  if (m_buildingGeometry != nullptr)
+    return !m_buildingGeometry->m_triangles.empty();
+  return !m_triangles.empty();
+}
+
+void ApplyAreaFeature::SetBuildingGeometry(std::shared_ptr<BuildingGeometry const> geometry)
+{
+  ASSERT(m_isBuilding, ());
+  ASSERT(m_triangles.empty(), ());
+  m_buildingGeometry = std::move(geometry);
+}
+
+std::shared_ptr<BuildingGeometry const> ApplyAreaFeature::FinishBuildingGeometry()
+{
+  ASSERT(m_isBuilding, ());
+  ASSERT(m_buildingGeometry == nullptr, ());
+
+  auto geometry = std::make_shared<BuildingGeometry>();
+  geometry->m_triangles = std::move(m_triangles);
+  // Normals are needed for 3D buildings only.
+  CalculateBuildingOutline(m_posZ > 0.0 /* calculateNormals */, geometry->m_outline);
+  m_buildingGeometry = std::move(geometry);
+  return m_buildingGeometry;
+}
+
 void ApplyAreaFeature::ProcessBuildingPolygon(m2::PointD const & p1, m2::PointD const & p2,
                                               m2::PointD const & p3)
 {
@@ -719,12 +748,22 @@ void ApplyAreaFeature::ProcessAreaRules(AreaRuleProto const * areaRule, AreaRule
   ASSERT(areaRule || hatchingRule, ());
   ASSERT(HasGeometry(), ());
 
+  if (m_isBuilding && m_buildingGeometry == nullptr)
+    FinishBuildingGeometry();
+
+  // Building triangles are owned by the (maybe cached) building geometry.
+  AreaShape::TrianglesPtr triangles;
+  if (m_buildingGeometry != nullptr)
+    triangles = AreaShape::TrianglesPtr(m_buildingGeometry, &m_buildingGeometry->m_triangles);
+  else
+    triangles = std::make_shared<std::vector<m2::PointD> const>(std::move(m_triangles));
+
   double areaDepth = drule::kBaseDepthBgBySize - 1;
 
   if (hatchingRule)
   {
     ASSERT_GREATER_OR_EQUAL(hatchingRule->priority(), drule::kBasePriorityFg, (m_f.DebugString()));
-    ProcessRule(*hatchingRule, areaDepth, true /* isHatching */);
+    ProcessRule(*hatchingRule, areaDepth, true /* isHatching */, triangles);
   }
 
   if (areaRule)
@@ -732,11 +771,12 @@ void ApplyAreaFeature::ProcessAreaRules(AreaRuleProto const * areaRule, AreaRule
     // Calculate areaDepth for BG-by-size areas only.
     if (areaRule->priority() < drule::kBasePriorityBgTop)
       areaDepth = drule::CalcAreaBySizeDepth(m_f);
-    ProcessRule(*areaRule, areaDepth, false /* isHatching */);
+    ProcessRule(*areaRule, areaDepth, false /* isHatching */, triangles);
   }
 }
 
-void ApplyAreaFeature::ProcessRule(AreaRuleProto const & areaRule, double areaDepth, bool isHatching)
+void ApplyAreaFeature::ProcessRule(AreaRuleProto const & areaRule, double areaDepth, bool isHatching,
+                                   std::shared_ptr<std::vector<m2::PointD> const> const & triangles)
 {
   AreaViewParams params;
   params.m_tileCenter = m_tileRect.Center();
@@ -760,14 +800,18 @@ void ApplyAreaFeature::ProcessRule(AreaRuleProto const & areaRule, double areaDe
 
     bool const calculateNormals = m_posZ > 0.0;
     if (calculateNormals || outline.m_generateOutline)
-      CalculateBuildingOutline(calculateNormals, outline);
+    {
+      BuildingOutline const & buildingOutline = m_buildingGeometry->m_outline;
+      outline.m_vertices = buildingOutline.m_vertices;
+      outline.m_indices = buildingOutline.m_indices;
+      if (calculateNormals)
+        outline.m_normals = buildingOutline.m_normals;
+    }
 
     params.m_is3D = !outline.m_indices.empty() && calculateNormals;
   }
 
-  // see ProcessAreaRules: isHatching first, - !isHatching last.
-  m_insertShape(make_unique_dp<AreaShape>(!isHatching ? std::move(m_triangles) : m_triangles,
-                                          std::move(outline), params));
+  m_insertShape(make_unique_dp<AreaShape>(triangles, std::move(outline), params));
 }
 
 ApplyLineFeatureGeometry::ApplyLineFeatureGeometry(TileKey const & tileKey, TInsertShapeFn const & insertShape,
@@ -15,6 +15,7 @@
 #include "geometry/spline.hpp"
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 class CaptionDefProto;
@@ -30,6 +31,7 @@ namespace df
 struct TextViewParams;
 class MapShape;
 struct BuildingOutline;
+struct BuildingGeometry;
 
 using TInsertShapeFn = std::function<void(drape_ptr<MapShape> && shape)>;
 
@@ -85,9 +87,16 @@ public:
                    CaptionDescription const & captions);
 
   void operator()(m2::PointD const & p1, m2::PointD const & p2, m2::PointD const & p3);
-  bool HasGeometry() const { return !m_triangles.empty(); }
+  bool HasGeometry() const;
   void ProcessAreaRules(AreaRuleProto const * areaRule, AreaRuleProto const * hatchingRule);
 
+  /// Building geometry doesn't depend on the tile, so it can be taken from the cache
+  /// instead of processing triangles of the feature.
+  void SetBuildingGeometry(std::shared_ptr<BuildingGeometry const> geometry);
+  /// Builds the building geometry from processed triangles, outline normals are calculated
+  /// for 3D buildings only. Call it once after processing all triangles of the feature.
+  std::shared_ptr<BuildingGeometry const> FinishBuildingGeometry();
+
   struct Edge
   {
     Edge() = default;
@@ -120,7 +129,8 @@ public:
 private:
   bool HasArea() const override { return true; }
 
-  void ProcessRule(AreaRuleProto const & areaRule, double areaDepth, bool isHatching);
+  void ProcessRule(AreaRuleProto const & areaRule, double areaDepth, bool isHatching,
+                   std::shared_ptr<std::vector<m2::PointD> const> const & triangles);
   void ProcessBuildingPolygon(m2::PointD const & p1, m2::PointD const & p2, m2::PointD const & p3);
   void CalculateBuildingOutline(bool calculateNormals, BuildingOutline & outline);
   int GetIndex(m2::PointD const & pt);
@@ -131,6 +141,7 @@ private:
   std::vector<m2::PointD> m_triangles;
   buffer_vector<m2::PointD, kBuildingOutlineSize> m_points;
   buffer_vector<ExtendedEdge, kBuildingOutlineSize> m_edges;
+  std::shared_ptr<BuildingGeometry const> m_buildingGeometry;
 
   float const m_minPosZ;
   bool const m_isBuilding;
@@ -8,6 +8,7 @@
 #include "drape/texture_manager.hpp"
 #include "drape/utils/vertex_decl.hpp"
 
+#include "base/assert.hpp"
 #include "base/buffer_vector.hpp"
 
 #include <algorithm>
@@ -15,12 +16,13 @@
 namespace df
 {
 
-AreaShape::AreaShape(std::vector<m2::PointD> triangleList, BuildingOutline && buildingOutline,
-                     AreaViewParams const & params)
+AreaShape::AreaShape(TrianglesPtr triangleList, BuildingOutline && buildingOutline, AreaViewParams const & params)
   : m_vertexes(std::move(triangleList))
   , m_buildingOutline(std::move(buildingOutline))
   , m_params(params)
-{}
+{
+  ASSERT(m_vertexes != nullptr, ());
+}
 
 void AreaShape::Draw(ref_ptr<dp::GraphicsContext> context, ref_ptr<dp::Batcher> batcher,
                      ref_ptr<dp::TextureManager> textures) const
@@ -52,8 +54,8 @@ void AreaShape::DrawArea(ref_ptr<dp::GraphicsContext> context, ref_ptr<dp::Batch
   glsl::vec2 const uv = glsl::ToVec2(colorUv);
 
   gpu::VBReservedSizeT<gpu::AreaVertex> vertexes;
-  vertexes.reserve(m_vertexes.size());
-  for (m2::PointD const & vertex : m_vertexes)
+  vertexes.reserve(m_vertexes->size());
+  for (m2::PointD const & vertex : *m_vertexes)
     vertexes.emplace_back(ToShapeVertex3(vertex), uv);
 
   auto const areaProgram = m_params.m_color.GetAlpha() == 255 ? gpu::Program::Area : gpu::Program::TransparentArea;
@@ -93,15 +95,15 @@ void AreaShape::DrawHatchingArea(ref_ptr<dp::GraphicsContext> context, ref_ptr<d
   glsl::vec2 const uv = glsl::ToVec2(colorUv);
 
   m2::RectD bbox;
-  for (auto const & v : m_vertexes)
+  for (auto const & v : *m_vertexes)
     bbox.Add(v);
 
   double const maxU = m_params.m_baseGtoPScale / hatchingTexture->GetWidth();
   double const maxV = m_params.m_baseGtoPScale / hatchingTexture->GetHeight();
 
   gpu::VBReservedSizeT<gpu::HatchingAreaVertex> vertexes;
-  vertexes.reserve(m_vertexes.size());
-  for (m2::PointD const & vertex : m_vertexes)
+  vertexes.reserve(m_vertexes->size());
+  for (m2::PointD const & vertex : *m_vertexes)
   {
     vertexes.emplace_back(ToShapeVertex3(vertex), uv,
                           glsl::vec2(static_cast<float>(maxU * (vertex.x - bbox.minX())),
@@ -129,7 +131,7 @@ void AreaShape::DrawArea3D(ref_ptr<dp::GraphicsContext> context, ref_ptr<dp::Bat
   glsl::vec2 const uv = glsl::ToVec2(colorUv);
 
   gpu::VBReservedSizeT<gpu::Area3dVertex> vertexes;
-  vertexes.reserve(m_vertexes.size() + m_buildingOutline.m_normals.size() * 6);
+  vertexes.reserve(m_vertexes->size() + m_buildingOutline.m_normals.size() * 6);
 
   for (size_t i = 0; i < m_buildingOutline.m_normals.size(); i++)
   {
@@ -150,7 +152,7 @@ void AreaShape::DrawArea3D(ref_ptr<dp::GraphicsContext> context, ref_ptr<dp::Bat
   }
 
   glsl::vec3 const normal(0.0f, 0.0f, -1.0f);
-  for (m2::PointD const & vertex : m_vertexes)
+  for (m2::PointD const & vertex : *m_vertexes)
     vertexes.emplace_back(glsl::vec3(ToShapeVertex2(vertex), -m_params.m_posZ), normal, uv);
 
   auto state = CreateRenderState(gpu::Program::Area3d, DepthLayer::Geometry3dLayer);
@@ -8,6 +8,7 @@
 
 #include "geometry/point2d.hpp"
 
+#include <memory>
 #include <vector>
 
 namespace df
@@ -24,12 +25,19 @@ struct BuildingOutline
 class AreaShape : public MapShape
 {
 public:
-  AreaShape(std::vector<m2::PointD> triangleList, BuildingOutline && buildingOutline,
-            AreaViewParams const & params);
+  /// Triangles are shared between the area and hatching shapes of the feature and
+  /// with the buildings geometry cache, so they aren't copied.
+  using TrianglesPtr = std::shared_ptr<std::vector<m2::PointD> const>;
+
+  AreaShape(TrianglesPtr triangleList, BuildingOutline && buildingOutline, AreaViewParams const & params);
 
   void Draw(ref_ptr<dp::GraphicsContext> context, ref_ptr<dp::Batcher> batcher,
             ref_ptr<dp::TextureManager> textures) const override;
 
+  std::vector<m2::PointD> const & GetTriangles() const { return *m_vertexes; }
+  BuildingOutline const & GetBuildingOutline() const { return m_buildingOutline; }
+  AreaViewParams const & GetParams() const { return m_params; }
+
 private:
   glsl::vec2 ToShapeVertex2(m2::PointD const & vertex) const
   {
@@ -50,7 +58,7 @@ private:
                         m2::PointD const & colorUv, ref_ptr<dp::Texture> texture,
                         ref_ptr<dp::Texture> hatchingTexture) const;
 
-  std::vector<m2::PointD> m_vertexes;
+  TrianglesPtr m_vertexes;
   BuildingOutline m_buildingOutline;
   AreaViewParams m_params;
 };
@@ -743,7 +743,7 @@ void BackendRenderer::InitContextDependentResources()
   // Increase this value for big features.
   uint32_t constexpr kBatchSize = 5000;
 
-  m_batchersPool = make_unique_dp<BatchersPool<TileKey, TileKeyStrictComparator>>(kReadingThreadsCount,
+  m_batchersPool = make_unique_dp<BatchersPool<TileKey, TileKeyStrictComparator>>(GetReadingThreadsCount(),
                                                std::bind(&BackendRenderer::FlushGeometry, this, _1, _2, _3),
                                                kBatchSize, kBatchSize);
   m_trafficGenerator->Init();
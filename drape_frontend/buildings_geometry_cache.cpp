@@ -0,0 +1,100 @@
+#include "drape_frontend/buildings_geometry_cache.hpp"
+
+#include "base/assert.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace df
+{
+size_t BuildingGeometry::GetMemorySize() const
+{
+  return sizeof(BuildingGeometry) + m_triangles.capacity() * sizeof(m2::PointD) +
+         m_outline.m_vertices.size() * sizeof(m2::PointD) + m_outline.m_indices.capacity() * sizeof(int) +
+         m_outline.m_normals.capacity() * sizeof(m2::PointD);
+}
+
+BuildingsGeometryCache::BuildingsGeometryCache(size_t maxMemorySize)
+  : m_maxShardMemorySize(std::max(size_t(1), maxMemorySize / kShardsCount))
+{
+  CHECK_GREATER(maxMemorySize, 0, ());
+}
+
+size_t BuildingsGeometryCache::KeyHash::operator()(Key const & key) const
+{
+  size_t const level = 2 * static_cast<size_t>(key.m_scaleIndex + 1) + (key.m_withNormals ? 1 : 0);
+  return std::hash<FeatureID>()(key.m_id) ^ (level * 0x9E3779B9);
+}
+
+BuildingsGeometryCache::Shard & BuildingsGeometryCache::GetShard(Key const & key)
+{
+  // High bits are used to not correlate with the buckets of the shard's index.
+  return m_shards[(KeyHash()(key) >> 16) % kShardsCount];
+}
+
+BuildingsGeometryCache::GeometryPtr BuildingsGeometryCache::Find(FeatureID const & id, int scaleIndex, bool withNormals)
+{
+  Key const key{id, scaleIndex, withNormals};
+  Shard & shard = GetShard(key);
+
+  std::lock_guard lock(shard.m_mutex);
+  auto const it = shard.m_index.find(key);
+  if (it == shard.m_index.end())
+    return nullptr;
+
+  shard.m_entries.splice(shard.m_entries.begin(), shard.m_entries, it->second);
+  return it->second->m_geometry;
+}
+
+void BuildingsGeometryCache::Insert(FeatureID const & id, int scaleIndex, bool withNormals, GeometryPtr geometry)
+{
+  ASSERT(geometry != nullptr, ());
+  Key key{id, scaleIndex, withNormals};
+  size_t const memorySize = geometry->GetMemorySize();
+  // Don't wash out the cache with a single huge building.
+  if (memorySize > m_maxShardMemorySize)
+    return;
+
+  Shard & shard = GetShard(key);
+
+  std::lock_guard lock(shard.m_mutex);
+  // The same building may be read concurrently by several tiles.
+  if (shard.m_index.find(key) != shard.m_index.end())
+    return;
+
+  shard.m_entries.emplace_front(Entry{key, std::move(geometry), memorySize});
+  shard.m_index.emplace(std::move(key), shard.m_entries.begin());
+  shard.m_memorySize += memorySize;
+
+  while (shard.m_memorySize > m_maxShardMemorySize)
+  {
+    auto const & lru = shard.m_entries.back();
+    shard.m_memorySize -= lru.m_memorySize;
+    shard.m_index.erase(lru.m_key);
+    shard.m_entries.pop_back();
+  }
+}
+
+void BuildingsGeometryCache::Clear()
+{
+  for (auto & shard : m_shards)
+  {
+    std::lock_guard lock(shard.m_mutex);
+    shard.m_index.clear();
+    shard.m_entries.clear();
+    shard.m_memorySize = 0;
+  }
+}
+
+size_t BuildingsGeometryCache::GetMemorySize() const
+{
+  size_t size = 0;
+  for (auto & shard : m_shards)
+  {
+    std::lock_guard lock(shard.m_mutex);
+    size += shard.m_memorySize;
+  }
+  return size;
+}
+}  // namespace df
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "drape_frontend/area_shape.hpp"
+
+#include "indexer/feature_decl.hpp"
+
+#include "geometry/point2d.hpp"
+
+#include "base/macros.hpp"
+
+#include <array>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace df
+{
+/// Derived geometry of a building: oriented triangles and the outline, with normals for 3D buildings.
+/// Buildings aren't clipped by the tile rect, so it doesn't depend on the tile.
+struct BuildingGeometry
+{
+  size_t GetMemorySize() const;
+
+  std::vector<m2::PointD> m_triangles;
+  BuildingOutline m_outline;
+};
+
+/// Thread-safe memory-bounded (LRU) cache of buildings geometry keyed by feature id,
+/// the index of the feature's triangles geometry level and presence of the normals, so tiles
+/// of different zoom levels which read the same geometry level share the entry.
+class BuildingsGeometryCache
+{
+public:
+  using GeometryPtr = std::shared_ptr<BuildingGeometry const>;
+
+  static size_t constexpr kDefaultMaxMemorySize = 16 * 1024 * 1024;
+
+  /// \param maxMemorySize Approximate memory limit of all cached geometry in bytes.
+  explicit BuildingsGeometryCache(size_t maxMemorySize = kDefaultMaxMemorySize);
+
+  /// \returns nullptr if there is no cached geometry.
+  GeometryPtr Find(FeatureID const & id, int scaleIndex, bool withNormals);
+  void Insert(FeatureID const & id, int scaleIndex, bool withNormals, GeometryPtr geometry);
+  void Clear();
+
+  size_t GetMemorySize() const;
+
+private:
+  struct Key
+  {
+    bool operator==(Key const & rhs) const
+    {
+      return m_scaleIndex == rhs.m_scaleIndex && m_withNormals == rhs.m_withNormals && m_id == rhs.m_id;
+    }
+
+    FeatureID m_id;
+    int m_scaleIndex;
+    bool m_withNormals;
+  };
+
+  struct KeyHash
+  {
+    size_t operator()(Key const & key) const;
+  };
+
+  struct Entry
+  {
+    Key m_key;
+    GeometryPtr m_geometry;
+    size_t m_memorySize;
+  };
+
+  using Entries = std::list<Entry>;
+
+  struct Shard
+  {
+    std::mutex m_mutex;
+    // Most recently used entries are at the front.
+    Entries m_entries;
+    std::unordered_map<Key, Entries::iterator, KeyHash> m_index;
+    size_t m_memorySize = 0;
+  };
+
+  static size_t constexpr kShardsCount = 8;
+
+  Shard & GetShard(Key const & key);
+
+  size_t const m_maxShardMemorySize;
+  mutable std::array<Shard, kShardsCount> m_shards;
+
+  DISALLOW_COPY_AND_MOVE(BuildingsGeometryCache);
+};
+}  // namespace df
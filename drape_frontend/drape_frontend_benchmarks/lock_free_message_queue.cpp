@@ -0,0 +1,306 @@
+#include "drape_frontend/drape_frontend_benchmarks/lock_free_message_queue.hpp"
+
+#include "base/assert.hpp"
+
+#include <algorithm>
+
+namespace message_queue_benchmark
+{
+size_t LockFreeMessageQueue::NodeList::Clear()
+{
+  size_t count = 0;
+  while (Node * node = PopFront())
+  {
+    delete node;
+    ++count;
+  }
+  return count;
+}
+
+void LockFreeMessageQueue::NodeList::PushBack(Node * node)
+{
+  node->m_next = nullptr;
+  if (m_last != nullptr)
+    m_last->m_next = node;
+  else
+    m_first = node;
+  m_last = node;
+}
+
+LockFreeMessageQueue::Node * LockFreeMessageQueue::NodeList::PopFront()
+{
+  Node * node = m_first;
+  if (node != nullptr)
+  {
+    m_first = node->m_next;
+    if (m_first == nullptr)
+      m_last = nullptr;
+  }
+  return node;
+}
+
+template <typename Fn>
+bool LockFreeMessageQueue::NodeList::AnyOf(Fn && fn) const
+{
+  for (Node const * node = m_first; node != nullptr; node = node->m_next)
+  {
+    if (fn(node->m_message))
+      return true;
+  }
+  return false;
+}
+
+template <typename Fn>
+size_t LockFreeMessageQueue::NodeList::EraseIf(Fn && fn)
+{
+  size_t count = 0;
+  Node * node = m_first;
+  m_first = m_last = nullptr;
+  while (node != nullptr)
+  {
+    Node * next = node->m_next;
+    if (fn(node->m_message))
+    {
+      delete node;
+      ++count;
+    }
+    else
+    {
+      PushBack(node);
+    }
+    node = next;
+  }
+  return count;
+}
+
+LockFreeMessageQueue::Lane::~Lane()
+{
+  Node * node = TakeAll();
+  while (node != nullptr)
+  {
+    Node * next = node->m_next;
+    delete node;
+    node = next;
+  }
+}
+
+void LockFreeMessageQueue::Lane::Push(drape_ptr<Message> && message)
+{
+  auto * node = new Node{std::move(message), m_head.load(std::memory_order_relaxed)};
+  while (!m_head.compare_exchange_weak(node->m_next, node, std::memory_order_release,
+                                       std::memory_order_relaxed))
+    ;
+}
+
+LockFreeMessageQueue::Node * LockFreeMessageQueue::Lane::TakeAll()
+{
+  // Skip an atomic read-modify-write for an empty lane.
+  if (m_head.load(std::memory_order_relaxed) == nullptr)
+    return nullptr;
+
+  Node * node = m_head.exchange(nullptr, std::memory_order_acquire);
+
+  // Reverse the list to the order of pushing.
+  Node * first = nullptr;
+  while (node != nullptr)
+  {
+    Node * next = node->m_next;
+    node->m_next = first;
+    first = node;
+    node = next;
+  }
+  return first;
+}
+
+LockFreeMessageQueue::LockFreeMessageQueue() = default;
+
+LockFreeMessageQueue::~LockFreeMessageQueue()
+{
+  CancelWait();
+}
+
+// static
+LockFreeMessageQueue::LaneIndex LockFreeMessageQueue::GetLaneIndex(MessagePriority priority)
+{
+  switch (priority)
+  {
+  case MessagePriority::Normal: return NormalLane;
+  case MessagePriority::High: return HighLane;
+  case MessagePriority::UberHighSingleton: return UberHighSingletonLane;
+  case MessagePriority::Low: return LowLane;
+  }
+  ASSERT(false, ("Unknown message priority type"));
+  return NormalLane;
+}
+
+drape_ptr<Message> LockFreeMessageQueue::PopMessage(bool waitForMessage)
+{
+  DrainLanes();
+
+  auto const hasMessages = [this]()
+  {
+    return std::any_of(m_messages.begin(), m_messages.end(),
+                       [](NodeList const & messages) { return !messages.IsEmpty(); });
+  };
+
+  if (waitForMessage && !hasMessages())
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_isWaiting = true;
+    // Producers check the flag after pushing, so a message pushed before the flag is set
+    // is seen here and a message pushed after that wakes us up. The store of the flag must not be
+    // reordered with the loads of the lanes, it's paired with the fence in PushMessage().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (AreLanesEmpty())
+      m_condition.wait(lock, [this]() { return !m_isWaiting; });
+    m_isWaiting = false;
+    lock.unlock();
+
+    DrainLanes();
+  }
+
+  for (auto & messages : m_messages)
+  {
+    if (Node * node = messages.PopFront())
+    {
+      drape_ptr<Message> msg = std::move(node->m_message);
+      delete node;
+      m_size.fetch_sub(1, std::memory_order_relaxed);
+      return msg;
+    }
+  }
+  return nullptr;
+}
+
+void LockFreeMessageQueue::PushMessage(drape_ptr<Message> && message, MessagePriority priority)
+{
+  m_size.fetch_add(1, std::memory_order_relaxed);
+  m_lanes[GetLaneIndex(priority)].Push(std::move(message));
+
+  // The push must not be reordered with the load of the flag, it's paired with the fence in PopMessage().
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_isWaiting)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    CancelWaitImpl();
+  }
+}
+
+void LockFreeMessageQueue::DrainLanes()
+{
+  if (m_needClear.exchange(false))
+    ClearImpl();
+
+  size_t dropped = 0;
+  for (size_t i = 0; i < m_lanes.size(); ++i)
+  {
+    auto & messages = m_messages[i];
+    Node * node = m_lanes[i].TakeAll();
+    while (node != nullptr)
+    {
+      Node * next = node->m_next;
+      bool drop = m_filter != nullptr && m_filter(make_ref(node->m_message));
+      if (!drop && i == UberHighSingletonLane)
+      {
+        auto const type = node->m_message->GetType();
+        drop = messages.AnyOf([type](drape_ptr<Message> const & msg) { return msg->GetType() == type; });
+      }
+
+      if (drop)
+      {
+        delete node;
+        ++dropped;
+      }
+      else
+      {
+        messages.PushBack(node);
+      }
+      node = next;
+    }
+  }
+
+  if (dropped != 0)
+    m_size.fetch_sub(dropped, std::memory_order_relaxed);
+}
+
+bool LockFreeMessageQueue::AreLanesEmpty() const
+{
+  return std::all_of(m_lanes.begin(), m_lanes.end(), [](Lane const & lane) { return lane.IsEmpty(); });
+}
+
+void LockFreeMessageQueue::FilterMessagesImpl()
+{
+  CHECK(m_filter != nullptr, ());
+
+  size_t dropped = 0;
+  for (auto & messages : m_messages)
+    dropped += messages.EraseIf([this](drape_ptr<Message> const & msg) { return m_filter(make_ref(msg)); });
+  m_size.fetch_sub(dropped, std::memory_order_relaxed);
+}
+
+void LockFreeMessageQueue::EnableMessageFiltering(FilterMessageFn && filter)
+{
+  m_filter = std::move(filter);
+  DrainLanes();
+  FilterMessagesImpl();
+}
+
+void LockFreeMessageQueue::DisableMessageFiltering()
+{
+  // Messages pushed while filtering was enabled are filtered out.
+  DrainLanes();
+  m_filter = nullptr;
+}
+
+void LockFreeMessageQueue::InstantFilter(FilterMessageFn && filter)
+{
+  CHECK(m_filter == nullptr, ());
+  m_filter = std::move(filter);
+  DrainLanes();
+  FilterMessagesImpl();
+  m_filter = nullptr;
+}
+
+size_t LockFreeMessageQueue::GetSize() const
+{
+  return m_size.load(std::memory_order_relaxed);
+}
+
+void LockFreeMessageQueue::CancelWait()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  CancelWaitImpl();
+}
+
+void LockFreeMessageQueue::CancelWaitImpl()
+{
+  if (m_isWaiting)
+  {
+    m_isWaiting = false;
+    m_condition.notify_all();
+  }
+}
+
+void LockFreeMessageQueue::ClearQuery()
+{
+  m_needClear = true;
+}
+
+void LockFreeMessageQueue::ClearImpl()
+{
+  size_t count = 0;
+  for (size_t i = 0; i < m_lanes.size(); ++i)
+  {
+    auto & messages = m_messages[i];
+    Node * node = m_lanes[i].TakeAll();
+    while (node != nullptr)
+    {
+      Node * next = node->m_next;
+      messages.PushBack(node);
+      node = next;
+    }
+    count += messages.Clear();
+  }
+  m_size.fetch_sub(count, std::memory_order_relaxed);
+}
+}  // namespace message_queue_benchmark
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "drape_frontend/message.hpp"
+
+#include "drape/pointers.hpp"
+
+#include "base/macros.hpp"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+namespace message_queue_benchmark
+{
+using df::Message;
+using df::MessagePriority;
+
+/// Candidate replacement of df::MessageQueue, it's kept here to compare them on multi-core devices.
+/// Multi-producer single-consumer queue of messages. Messages are pushed without locks
+/// into a lane of their priority, the consumer takes all messages of a lane by one atomic
+/// operation and processes them in order: UberHighSingleton, High, Normal and Low lanes.
+/// The mutex is used for sleeping of the consumer on an empty queue only.
+/// PopMessage() and filtering methods must be called on the consumer thread.
+///
+/// Differences from df::MessageQueue:
+/// - UberHighSingleton and High messages are popped in the order of pushing. df::MessageQueue puts
+///   each of them before the messages of the same priority, so the last pushed one is popped first.
+/// - A singleton of a type which is already in the queue is dropped on draining by the consumer,
+///   not on pushing.
+/// - ClearQuery() only sets m_needClear, messages are released on the next PopMessage().
+class LockFreeMessageQueue
+{
+public:
+  LockFreeMessageQueue();
+  ~LockFreeMessageQueue();
+
+  // If the queue is empty then it returns nullptr or wait for a message.
+  drape_ptr<Message> PopMessage(bool waitForMessage);
+  void PushMessage(drape_ptr<Message> && message, MessagePriority priority);
+  void CancelWait();
+  // Messages are released by the consumer on the next PopMessage() or by the destructor,
+  // so it may be called from any thread.
+  void ClearQuery();
+
+  using FilterMessageFn = std::function<bool(ref_ptr<Message>)>;
+  void EnableMessageFiltering(FilterMessageFn && filter);
+  void DisableMessageFiltering();
+  void InstantFilter(FilterMessageFn && filter);
+
+  size_t GetSize() const;
+
+private:
+  struct Node
+  {
+    drape_ptr<Message> m_message;
+    Node * m_next = nullptr;
+  };
+
+  // Drained messages of a lane, they are accessed by the consumer only.
+  class NodeList
+  {
+  public:
+    NodeList() = default;
+    ~NodeList() { Clear(); }
+
+    bool IsEmpty() const { return m_first == nullptr; }
+    size_t Clear();
+    void PushBack(Node * node);
+    Node * PopFront();
+    template <typename Fn>
+    bool AnyOf(Fn && fn) const;
+    template <typename Fn>
+    size_t EraseIf(Fn && fn);
+
+  private:
+    Node * m_first = nullptr;
+    Node * m_last = nullptr;
+
+    DISALLOW_COPY_AND_MOVE(NodeList);
+  };
+
+  // Lanes are on separate cache lines to not slow down producers of different priorities.
+  class alignas(64) Lane
+  {
+  public:
+    Lane() = default;
+    ~Lane();
+
+    void Push(drape_ptr<Message> && message);
+    // Takes all pushed messages by one atomic operation.
+    // \returns The list in the order of pushing.
+    Node * TakeAll();
+    bool IsEmpty() const { return m_head.load() == nullptr; }
+
+  private:
+    // The last pushed message is at the head.
+    std::atomic<Node *> m_head = nullptr;
+
+    DISALLOW_COPY_AND_MOVE(Lane);
+  };
+
+  enum LaneIndex
+  {
+    UberHighSingletonLane,
+    HighLane,
+    NormalLane,
+    LowLane,
+
+    LanesCount
+  };
+
+  static LaneIndex GetLaneIndex(MessagePriority priority);
+
+  void DrainLanes();
+  bool AreLanesEmpty() const;
+  void FilterMessagesImpl();
+  void ClearImpl();
+  void CancelWaitImpl();
+
+  std::array<Lane, LanesCount> m_lanes;
+  std::array<NodeList, LanesCount> m_messages;
+  FilterMessageFn m_filter;
+
+  std::atomic<size_t> m_size = 0;
+  std::atomic<bool> m_needClear = false;
+
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::atomic<bool> m_isWaiting = false;
+};
+}  // namespace message_queue_benchmark
@@ -0,0 +1,130 @@
+#include "testing/benchmark.hpp"
+#include "testing/testing.hpp"
+
+#include "drape_frontend/drape_frontend_benchmarks/lock_free_message_queue.hpp"
+#include "drape_frontend/message_queue.hpp"
+
+#include "base/logging.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace message_queue_benchmark
+{
+class TestMessage : public Message
+{
+public:
+  explicit TestMessage(Type type) : m_type(type), m_pushTime(std::chrono::steady_clock::now()) {}
+
+  Type GetType() const override { return m_type; }
+
+  std::chrono::steady_clock::time_point GetPushTime() const { return m_pushTime; }
+
+private:
+  Type const m_type;
+  std::chrono::steady_clock::time_point const m_pushTime;
+};
+
+struct BenchmarkResult
+{
+  double m_seconds = 0.0;
+  double m_avgLatencyUs = 0.0;
+  double m_maxLatencyUs = 0.0;
+  int m_popped = 0;
+};
+
+// Several producers post a mix of messages similar to the backend and the frontend ones:
+// mostly normal (tiles, overlays), some high and low, rare singletons.
+template <typename Queue>
+BenchmarkResult RunBenchmark(int producersCount, int messagesPerProducer)
+{
+  Queue queue;
+  std::atomic<int> finishedProducers = 0;
+
+  auto const start = std::chrono::steady_clock::now();
+  std::vector<std::thread> producers;
+  for (int p = 0; p < producersCount; ++p)
+  {
+    producers.emplace_back([&queue, &finishedProducers, messagesPerProducer]()
+    {
+      for (int i = 0; i < messagesPerProducer; ++i)
+      {
+        MessagePriority priority = MessagePriority::Normal;
+        Message::Type type = Message::Type::MapShapeReaded;
+        if (i % 100 == 0)
+        {
+          priority = MessagePriority::UberHighSingleton;
+          type = Message::Type::FinishReading;
+        }
+        else if (i % 10 == 0)
+        {
+          priority = MessagePriority::High;
+        }
+        else if (i % 20 == 1)
+        {
+          priority = MessagePriority::Low;
+        }
+        queue.PushMessage(make_unique_dp<TestMessage>(type), priority);
+      }
+      ++finishedProducers;
+      // Wake up the consumer to let it check finishing.
+      queue.PushMessage(make_unique_dp<TestMessage>(Message::Type::Unknown), MessagePriority::Normal);
+    });
+  }
+
+  BenchmarkResult result;
+  double totalLatencyUs = 0.0;
+  while (true)
+  {
+    auto msg = queue.PopMessage(finishedProducers < producersCount /* waitForMessage */);
+    if (msg == nullptr)
+    {
+      if (finishedProducers == producersCount)
+        break;
+      continue;
+    }
+
+    auto const & testMsg = static_cast<TestMessage const &>(*msg);
+    double const latencyUs =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - testMsg.GetPushTime()).count();
+    totalLatencyUs += latencyUs;
+    result.m_maxLatencyUs = std::max(result.m_maxLatencyUs, latencyUs);
+    ++result.m_popped;
+  }
+
+  for (auto & producer : producers)
+    producer.join();
+  while (auto msg = queue.PopMessage(false /* waitForMessage */))
+    ++result.m_popped;
+
+  result.m_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  if (result.m_popped > 0)
+    result.m_avgLatencyUs = totalLatencyUs / result.m_popped;
+  return result;
+}
+
+template <typename Queue>
+void LogBenchmark(std::string const & name, int producersCount)
+{
+  int constexpr kMessagesPerProducer = 100000;
+  auto const result = RunBenchmark<Queue>(producersCount, kMessagesPerProducer);
+  // Singletons are merged, so the count may be less, but normal messages must be delivered.
+  TEST_GREATER_OR_EQUAL(result.m_popped, producersCount * kMessagesPerProducer * 99 / 100, ());
+  LOG(LINFO, (name, "queue,", producersCount, "producers:", result.m_seconds, "s, latency avg",
+              result.m_avgLatencyUs, "us, max", result.m_maxLatencyUs, "us"));
+}
+
+BENCHMARK_TEST(MessageQueue_Producers)
+{
+  LOG(LINFO, ("Hardware threads:", std::thread::hardware_concurrency()));
+  for (int producersCount : {1, 2, 4, 8})
+  {
+    LogBenchmark<df::MessageQueue>("Mutex", producersCount);
+    LogBenchmark<LockFreeMessageQueue>("Lock-free", producersCount);
+  }
+}
+}  // namespace message_queue_benchmark
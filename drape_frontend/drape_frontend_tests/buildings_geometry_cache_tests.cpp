@@ -0,0 +1,165 @@
+#include "testing/testing.hpp"
+
+#include "drape_frontend/apply_feature_functors.hpp"
+#include "drape_frontend/area_shape.hpp"
+#include "drape_frontend/buildings_geometry_cache.hpp"
+#include "drape_frontend/tile_key.hpp"
+
+#include "indexer/drawing_rule_def.hpp"
+#include "indexer/drules_include.hpp"
+#include "indexer/feature.hpp"
+#include "indexer/map_object.hpp"
+
+#include "drape/pointers.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace buildings_geometry_cache_tests
+{
+using df::BuildingGeometry;
+using df::BuildingsGeometryCache;
+
+BuildingsGeometryCache::GeometryPtr MakeGeometry(size_t trianglesCount)
+{
+  auto geometry = std::make_shared<BuildingGeometry>();
+  geometry->m_triangles.resize(trianglesCount * 3);
+  return geometry;
+}
+
+UNIT_TEST(BuildingsGeometryCache_Smoke)
+{
+  BuildingsGeometryCache cache;
+  FeatureID const id(MwmSet::MwmId(), 1);
+
+  TEST(cache.Find(id, 0, false /* withNormals */) == nullptr, ());
+
+  auto const geometry = MakeGeometry(10);
+  cache.Insert(id, 0, false /* withNormals */, geometry);
+  TEST(cache.Find(id, 0, false /* withNormals */) == geometry, ());
+  // Another geometry level is another entry.
+  TEST(cache.Find(id, 1, false /* withNormals */) == nullptr, ());
+  // 3D geometry is another entry.
+  TEST(cache.Find(id, 0, true /* withNormals */) == nullptr, ());
+  TEST(cache.Find(FeatureID(MwmSet::MwmId(), 2), 0, false /* withNormals */) == nullptr, ());
+
+  // The first inserted geometry is kept.
+  cache.Insert(id, 0, false /* withNormals */, MakeGeometry(20));
+  TEST(cache.Find(id, 0, false /* withNormals */) == geometry, ());
+  TEST_EQUAL(cache.GetMemorySize(), geometry->GetMemorySize(), ());
+
+  cache.Clear();
+  TEST(cache.Find(id, 0, false /* withNormals */) == nullptr, ());
+  TEST_EQUAL(cache.GetMemorySize(), 0, ());
+}
+
+UNIT_TEST(BuildingsGeometryCache_MemoryLimit)
+{
+  size_t const maxMemorySize = 64 * 1024;
+  BuildingsGeometryCache cache(maxMemorySize);
+
+  for (uint32_t i = 0; i < 1000; ++i)
+    cache.Insert(FeatureID(MwmSet::MwmId(), i), 0, false /* withNormals */, MakeGeometry(10));
+  TEST_LESS_OR_EQUAL(cache.GetMemorySize(), maxMemorySize, ());
+
+  // Least recently used buildings are evicted.
+  TEST(cache.Find(FeatureID(MwmSet::MwmId(), 0), 0, false /* withNormals */) == nullptr, ());
+  TEST(cache.Find(FeatureID(MwmSet::MwmId(), 999), 0, false /* withNormals */) != nullptr, ());
+
+  // Too big geometry isn't cached.
+  FeatureID const hugeId(MwmSet::MwmId(), 1000);
+  cache.Insert(hugeId, 0, false /* withNormals */, MakeGeometry(maxMemorySize));
+  TEST(cache.Find(hugeId, 0, false /* withNormals */) == nullptr, ());
+}
+
+class AreaObject : public osm::MapObject
+{
+public:
+  AreaObject(FeatureID const & id, std::vector<m2::PointD> const & triangles)
+  {
+    m_featureID = id;
+    m_geomType = feature::GeomType::Area;
+    m_triangles = triangles;
+  }
+};
+
+using Shapes = std::vector<drape_ptr<df::MapShape>>;
+
+df::AreaShape const & GetAreaShape(Shapes const & shapes)
+{
+  TEST_EQUAL(shapes.size(), 1, ());
+  auto const * shape = dynamic_cast<df::AreaShape const *>(shapes.front().get());
+  TEST(shape != nullptr, ());
+  return *shape;
+}
+
+// Shapes of a building are the same when its triangles are processed and when its geometry is taken
+// from the cache.
+UNIT_TEST(BuildingsGeometryCache_CachedShapeIsSame)
+{
+  int constexpr kZoom = 17;
+  df::TileKey const tileKey(0, 0, kZoom);
+
+  // L-shaped building.
+  double constexpr kSize = 1e-4;
+  std::vector<m2::PointD> triangles = {{0, 0}, {2, 0}, {2, 1}, {0, 0}, {2, 1}, {1, 1},
+                                       {0, 0}, {1, 1}, {1, 2}, {0, 0}, {1, 2}, {0, 2}};
+  for (auto & p : triangles)
+    p *= kSize;
+  AreaObject const object(FeatureID(MwmSet::MwmId(), 1), triangles);
+
+  AreaRuleProto rule;
+  rule.set_color(0xFFFF0000);
+  rule.set_priority(static_cast<int>(drule::kBasePriorityFg));
+  rule.mutable_border()->set_color(0xFF00FF00);
+  rule.mutable_border()->set_width(1.0);
+
+  for (float const posZ : {0.0f, 10.0f})
+  {
+    auto const f = FeatureType::CreateFromMapObject(object);
+    auto const makeApply = [&](Shapes & shapes)
+    {
+      auto const insertShape = [&shapes](drape_ptr<df::MapShape> && shape) { shapes.push_back(std::move(shape)); };
+      return df::ApplyAreaFeature(tileKey, insertShape, *f, 1.0 /* currentScaleGtoP */, true /* isBuilding */,
+                                  0.0f /* minPosZ */, posZ, df::CaptionDescription());
+    };
+
+    Shapes processedShapes;
+    auto processed = makeApply(processedShapes);
+    f->ForEachTriangle(processed, kZoom);
+    auto const geometry = processed.FinishBuildingGeometry();
+    processed.ProcessAreaRules(&rule, nullptr /* hatchingRule */);
+
+    Shapes cachedShapes;
+    auto cached = makeApply(cachedShapes);
+    cached.SetBuildingGeometry(geometry);
+    TEST(cached.HasGeometry(), ());
+    cached.ProcessAreaRules(&rule, nullptr /* hatchingRule */);
+
+    auto const & processedShape = GetAreaShape(processedShapes);
+    auto const & cachedShape = GetAreaShape(cachedShapes);
+
+    // Triangles are shared with the cache entry.
+    TEST(&processedShape.GetTriangles() == &geometry->m_triangles, ());
+    TEST(&cachedShape.GetTriangles() == &geometry->m_triangles, ());
+    TEST_EQUAL(geometry->m_triangles.size(), triangles.size(), ());
+
+    auto const & processedOutline = processedShape.GetBuildingOutline();
+    auto const & cachedOutline = cachedShape.GetBuildingOutline();
+    TEST(processedOutline.m_generateOutline, ());
+    TEST_EQUAL(cachedOutline.m_generateOutline, processedOutline.m_generateOutline, ());
+    TEST(cachedOutline.m_vertices == processedOutline.m_vertices, ());
+    TEST_EQUAL(cachedOutline.m_indices, processedOutline.m_indices, ());
+    TEST_EQUAL(cachedOutline.m_normals, processedOutline.m_normals, ());
+    TEST_EQUAL(cachedShape.GetParams().m_is3D, processedShape.GetParams().m_is3D, ());
+    TEST_EQUAL(cachedShape.GetParams().m_depth, processedShape.GetParams().m_depth, ());
+
+    // Normals are calculated for 3D buildings only.
+    bool const is3D = posZ > 0.0f;
+    TEST_EQUAL(processedShape.GetParams().m_is3D, is3D, ());
+    TEST_EQUAL(geometry->m_outline.m_normals.empty(), !is3D, ());
+    TEST_EQUAL(processedOutline.m_normals.empty(), !is3D, ());
+  }
+}
+}  // namespace buildings_geometry_cache_tests
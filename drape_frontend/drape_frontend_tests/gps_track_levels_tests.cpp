@@ -0,0 +1,104 @@
+#include "testing/testing.hpp"
+
+#include "drape_frontend/gps_track_levels.hpp"
+
+#include <vector>
+
+namespace gps_track_levels_tests
+{
+using df::GpsTrackLevels;
+using df::GpsTrackPoint;
+
+GpsTrackPoint MakePoint(uint32_t id, double x, double y, double timestamp)
+{
+  GpsTrackPoint pt;
+  pt.m_id = id;
+  pt.m_point = m2::PointD(x, y);
+  pt.m_timestamp = timestamp;
+  pt.m_speedMPS = 1.0;
+  return pt;
+}
+
+UNIT_TEST(GpsTrackLevels_Simplification)
+{
+  GpsTrackLevels levels;
+  TEST(levels.IsEmpty(), ());
+
+  // A straight track with a point per second and a step smaller than the first tolerance.
+  std::vector<GpsTrackPoint> points;
+  double const step = levels.GetTolerance(1) / 10.0;
+  for (uint32_t i = 0; i < 10000; ++i)
+    points.push_back(MakePoint(i, i * step, 0.0, i));
+  levels.Append(points);
+
+  TEST_EQUAL(levels.GetPoints(0).size(), points.size(), ());
+  // About every 10th point is on the level 1.
+  TEST_LESS(levels.GetPoints(1).size(), points.size() / 5, ());
+  for (size_t level = 1; level < levels.GetLevelsCount(); ++level)
+  {
+    auto const & levelPoints = levels.GetPoints(level);
+    TEST_LESS_OR_EQUAL(levelPoints.size(), levels.GetPoints(level - 1).size(), (level));
+    // The track keeps its ends.
+    TEST_EQUAL(levelPoints.front().m_id, 0, (level));
+    TEST_EQUAL(levelPoints.back().m_id, points.back().m_id, (level));
+    for (size_t i = 1; i + 1 < levelPoints.size(); ++i)
+    {
+      TEST_GREATER_OR_EQUAL(levelPoints[i].m_point.Length(levelPoints[i - 1].m_point),
+                            levels.GetTolerance(level), (level, i));
+    }
+    TEST_EQUAL(levels.GetSpline(level).GetSize(), levelPoints.size(), (level));
+  }
+
+  TEST_EQUAL(levels.GetLevel(0.0), 0, ());
+  TEST_EQUAL(levels.GetLevel(levels.GetTolerance(2)), 2, ());
+  TEST_EQUAL(levels.GetLevel(1e10), levels.GetLevelsCount() - 1, ());
+}
+
+UNIT_TEST(GpsTrackLevels_TimeGap)
+{
+  GpsTrackLevels levels;
+  size_t const level = levels.GetLevelsCount() - 1;
+  double const step = levels.GetTolerance(level) / 100.0;
+
+  levels.Append({MakePoint(0, 0.0, 0.0, 0.0), MakePoint(1, step, 0.0, 1.0), MakePoint(2, 2 * step, 0.0, 2.0)});
+  TEST_EQUAL(levels.GetPoints(level).size(), 2, ());
+
+  // Points around the gap are kept even if they are close.
+  levels.Append({MakePoint(3, 3 * step, 0.0, 2.0 + 2 * GpsTrackLevels::kTimeGapSec),
+                 MakePoint(4, 4 * step, 0.0, 3.0 + 2 * GpsTrackLevels::kTimeGapSec)});
+  auto const & points = levels.GetPoints(level);
+  TEST_EQUAL(points.size(), 4, ());
+  TEST_EQUAL(points[1].m_id, 2, ());
+  TEST_EQUAL(points[2].m_id, 3, ());
+  TEST_EQUAL(points[3].m_id, 4, ());
+}
+
+UNIT_TEST(GpsTrackLevels_Remove)
+{
+  GpsTrackLevels levels;
+  std::vector<GpsTrackPoint> points;
+  for (uint32_t i = 0; i < 1000; ++i)
+    points.push_back(MakePoint(i, i * 1e-4, 0.0, i));
+  levels.Append(points);
+
+  std::vector<uint32_t> toRemove;
+  for (uint32_t i = 0; i < 500; ++i)
+    toRemove.push_back(i);
+  levels.Remove(toRemove);
+
+  for (size_t level = 0; level < levels.GetLevelsCount(); ++level)
+  {
+    auto const & levelPoints = levels.GetPoints(level);
+    TEST(!levelPoints.empty(), (level));
+    TEST_GREATER_OR_EQUAL(levelPoints.front().m_id, 500, (level));
+    TEST_EQUAL(levelPoints.back().m_id, 999, (level));
+    TEST_EQUAL(levels.GetSpline(level).GetSize(), levelPoints.size(), (level));
+  }
+  TEST_EQUAL(levels.GetPoints(0).size(), 500, ());
+
+  levels.Clear();
+  TEST(levels.IsEmpty(), ());
+  levels.Append({MakePoint(1000, 0.0, 0.0, 1000.0)});
+  TEST_EQUAL(levels.GetPoints(levels.GetLevelsCount() - 1).size(), 1, ());
+}
+}  // namespace gps_track_levels_tests
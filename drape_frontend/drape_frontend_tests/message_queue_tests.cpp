@@ -0,0 +1,190 @@
+#include "testing/testing.hpp"
+
+#include "drape_frontend/message_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace message_queue_tests
+{
+using df::Message;
+using df::MessagePriority;
+using df::MessageQueue;
+
+class TestMessage : public Message
+{
+public:
+  TestMessage(Type type, int id, bool isContextDependent = false)
+    : m_type(type), m_id(id), m_isContextDependent(isContextDependent)
+  {}
+
+  Type GetType() const override { return m_type; }
+  bool IsGraphicsContextDependent() const override { return m_isContextDependent; }
+
+  int GetId() const { return m_id; }
+
+private:
+  Type const m_type;
+  int const m_id;
+  bool const m_isContextDependent;
+};
+
+void Push(MessageQueue & queue, int id, MessagePriority priority,
+          Message::Type type = Message::Type::Unknown, bool isContextDependent = false)
+{
+  queue.PushMessage(make_unique_dp<TestMessage>(type, id, isContextDependent), priority);
+}
+
+std::vector<int> PopAll(MessageQueue & queue)
+{
+  std::vector<int> ids;
+  while (auto msg = queue.PopMessage(false /* waitForMessage */))
+    ids.push_back(static_cast<TestMessage const &>(*msg).GetId());
+  return ids;
+}
+
+UNIT_TEST(MessageQueue_Priorities)
+{
+  MessageQueue queue;
+  Push(queue, 1, MessagePriority::Normal);
+  Push(queue, 2, MessagePriority::Low);
+  Push(queue, 3, MessagePriority::High);
+  Push(queue, 4, MessagePriority::Normal);
+  Push(queue, 5, MessagePriority::UberHighSingleton, Message::Type::FinishReading);
+  // The same singleton message is dropped while the first one is in the queue.
+  Push(queue, 6, MessagePriority::UberHighSingleton, Message::Type::FinishReading);
+  Push(queue, 7, MessagePriority::UberHighSingleton, Message::Type::FlushTile);
+  TEST_EQUAL(queue.GetSize(), 6, ());
+
+  TEST_EQUAL(PopAll(queue), std::vector<int>({7, 5, 3, 1, 4, 2}), ());
+  TEST_EQUAL(queue.GetSize(), 0, ());
+
+  Push(queue, 8, MessagePriority::UberHighSingleton, Message::Type::FinishReading);
+  TEST_EQUAL(PopAll(queue), std::vector<int>({8}), ());
+}
+
+UNIT_TEST(MessageQueue_Filtering)
+{
+  MessageQueue queue;
+  Push(queue, 1, MessagePriority::Normal, Message::Type::Unknown, true /* isContextDependent */);
+  Push(queue, 2, MessagePriority::Normal);
+
+  queue.EnableMessageFiltering([](ref_ptr<Message> msg) { return msg->IsGraphicsContextDependent(); });
+  Push(queue, 3, MessagePriority::Normal, Message::Type::Unknown, true /* isContextDependent */);
+  Push(queue, 4, MessagePriority::Low);
+  queue.DisableMessageFiltering();
+  Push(queue, 5, MessagePriority::Normal, Message::Type::Unknown, true /* isContextDependent */);
+  TEST_EQUAL(queue.GetSize(), 3, ());
+
+  queue.InstantFilter([](ref_ptr<Message> msg)
+  {
+    return static_cast<TestMessage const *>(msg.get())->GetId() == 4;
+  });
+  TEST_EQUAL(PopAll(queue), std::vector<int>({2, 5}), ());
+
+}
+
+UNIT_TEST(MessageQueue_SingletonsOrder)
+{
+  MessageQueue queue;
+  Push(queue, 1, MessagePriority::High);
+  Push(queue, 2, MessagePriority::High);
+  Push(queue, 3, MessagePriority::UberHighSingleton, Message::Type::FinishReading);
+  Push(queue, 4, MessagePriority::UberHighSingleton, Message::Type::FlushTile);
+  // A singleton of the type which is in the queue is dropped on pushing, the first one keeps its place.
+  Push(queue, 5, MessagePriority::UberHighSingleton, Message::Type::FinishReading);
+  TEST_EQUAL(queue.GetSize(), 4, ());
+
+  // Singleton and high priority messages are pushed to the front of their priority,
+  // so the last pushed one is popped first.
+  TEST_EQUAL(PopAll(queue), std::vector<int>({4, 3, 2, 1}), ());
+}
+
+UNIT_TEST(MessageQueue_Clear)
+{
+  MessageQueue queue;
+  Push(queue, 1, MessagePriority::Normal);
+  Push(queue, 2, MessagePriority::Low);
+  Push(queue, 3, MessagePriority::UberHighSingleton, Message::Type::FinishReading);
+
+  // Messages are released immediately, not on the next PopMessage().
+  queue.ClearQuery();
+  TEST_EQUAL(queue.GetSize(), 0, ());
+  TEST_EQUAL(PopAll(queue), std::vector<int>(), ());
+
+  // A singleton of the cleared type is accepted again.
+  Push(queue, 4, MessagePriority::UberHighSingleton, Message::Type::FinishReading);
+  TEST_EQUAL(PopAll(queue), std::vector<int>({4}), ());
+}
+
+UNIT_TEST(MessageQueue_Wait)
+{
+  MessageQueue queue;
+
+  std::thread producer([&queue]()
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    Push(queue, 1, MessagePriority::Normal);
+  });
+  auto msg = queue.PopMessage(true /* waitForMessage */);
+  producer.join();
+  TEST(msg != nullptr, ());
+  TEST_EQUAL(static_cast<TestMessage const &>(*msg).GetId(), 1, ());
+
+  // CancelWait() doesn't affect the next waiting if it comes before, so it's repeated.
+  std::atomic<bool> cancelled = false;
+  std::thread canceller([&queue, &cancelled]()
+  {
+    while (!cancelled)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      queue.CancelWait();
+    }
+  });
+  TEST(queue.PopMessage(true /* waitForMessage */) == nullptr, ());
+  cancelled = true;
+  canceller.join();
+}
+
+UNIT_TEST(MessageQueue_Producers)
+{
+  int constexpr kProducersCount = 3;
+  int constexpr kMessagesPerProducer = 1000;
+
+  MessageQueue queue;
+  std::atomic<int> finishedProducers = 0;
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducersCount; ++p)
+  {
+    producers.emplace_back([&queue, &finishedProducers, p]()
+    {
+      for (int i = 0; i < kMessagesPerProducer; ++i)
+        Push(queue, p * kMessagesPerProducer + i, MessagePriority::Normal);
+      ++finishedProducers;
+      queue.CancelWait();
+    });
+  }
+
+  // Messages of every producer are popped in the order of pushing.
+  std::vector<int> lastIds(kProducersCount, -1);
+  int popped = 0;
+  while (popped < kProducersCount * kMessagesPerProducer)
+  {
+    auto msg = queue.PopMessage(finishedProducers < kProducersCount /* waitForMessage */);
+    if (msg == nullptr)
+      continue;
+
+    int const id = static_cast<TestMessage const &>(*msg).GetId();
+    int & lastId = lastIds[id / kMessagesPerProducer];
+    TEST_LESS(lastId, id, ());
+    lastId = id;
+    ++popped;
+  }
+
+  for (auto & producer : producers)
+    producer.join();
+  TEST_EQUAL(queue.GetSize(), 0, ());
+}
+}  // namespace message_queue_tests
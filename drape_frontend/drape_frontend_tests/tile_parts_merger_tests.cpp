@@ -0,0 +1,86 @@
+#include "testing/testing.hpp"
+
+#include "drape_frontend/tile_parts_merger.hpp"
+
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace tile_parts_merger_tests
+{
+using Features = std::vector<FeatureID>;
+
+// Processes features of a tile like TileInfo does: in parts, which skip some features, and merges
+// the parts by TilePartsMerger. The result of a feature is the feature itself.
+Features ProcessInParts(Features const & features, std::set<uint32_t> const & skipped, size_t partsCount,
+                        std::set<uint32_t> const & unread = {})
+{
+  // Chunks of processed features of every part.
+  std::vector<std::vector<Features>> partsChunks(partsCount);
+  std::vector<Features> skippedFeatures(partsCount);
+  for (size_t i = 0; i < partsCount; ++i)
+  {
+    auto & chunks = partsChunks[i];
+    chunks.emplace_back();
+    for (size_t j = i * features.size() / partsCount; j < (i + 1) * features.size() / partsCount; ++j)
+    {
+      if (skipped.count(features[j].m_index) != 0)
+      {
+        skippedFeatures[i].push_back(features[j]);
+        chunks.emplace_back();
+      }
+      else
+      {
+        chunks.back().push_back(features[j]);
+      }
+    }
+  }
+
+  Features result;
+  df::TilePartsMerger merger(std::move(skippedFeatures), [&](size_t partIndex, size_t chunkIndex)
+  {
+    TEST_LESS(chunkIndex, partsChunks[partIndex].size(), ());
+    auto & chunk = partsChunks[partIndex][chunkIndex];
+    result.insert(result.end(), chunk.begin(), chunk.end());
+    chunk.clear();
+  });
+
+  for (auto const & id : merger.GetSkippedFeatures())
+  {
+    if (unread.count(id.m_index) != 0)
+      continue;
+    merger.MergeUntil(id);
+    result.push_back(id);
+  }
+  merger.MergeAll();
+  return result;
+}
+
+UNIT_TEST(TilePartsMerger_SameOrderAsSerial)
+{
+  Features features;
+  for (uint32_t i = 0; i < 50; ++i)
+    features.emplace_back(MwmSet::MwmId(), i);
+
+  // Skipped features are in a row, at the begin and the end of the tile and of the parts.
+  std::set<uint32_t> const skipped = {0, 1, 7, 12, 13, 14, 24, 25, 30, 49};
+  for (size_t partsCount : {1, 2, 3, 4, 7})
+  {
+    TEST_EQUAL(ProcessInParts(features, skipped, partsCount), features, (partsCount));
+    TEST_EQUAL(ProcessInParts(features, {} /* skipped */, partsCount), features, (partsCount));
+    TEST_EQUAL(ProcessInParts(features, {0, 49}, partsCount), features, (partsCount));
+  }
+
+  // Unread skipped features don't break the order of the rest.
+  std::set<uint32_t> const unread = {7, 13, 49};
+  Features expected;
+  for (auto const & id : features)
+  {
+    if (unread.count(id.m_index) == 0)
+      expected.push_back(id);
+  }
+  for (size_t partsCount : {1, 2, 4})
+    TEST_EQUAL(ProcessInParts(features, skipped, partsCount, unread), expected, (partsCount));
+}
+}  // namespace tile_parts_merger_tests
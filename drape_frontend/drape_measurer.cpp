@@ -4,11 +4,22 @@
 
 #include "geometry/mercator.hpp"
 
+#include "base/logging.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
+#include <sstream>
 
 namespace df
 {
+namespace
+{
+// Frames are rendered at 30 FPS at least (see kFrameTime in FrontendRenderer::RenderFrame),
+// longer frames are counted as slow by the telemetry.
+auto constexpr kTargetFrameTime = std::chrono::nanoseconds(std::chrono::seconds(1)) / 30;
+}  // namespace
+
 DrapeMeasurer & DrapeMeasurer::Instance()
 {
   static DrapeMeasurer s_inst;
@@ -247,7 +258,11 @@ DrapeMeasurer::RenderStatistic DrapeMeasurer::GetRenderStatistic()
 
 void DrapeMeasurer::BeforeRenderFrame()
 {
-  if (!m_isEnabled)
+  // Stages time is collected per frame. It is reset even if telemetry is disabled to not keep
+  // stages of a frame during which telemetry was switched off.
+  m_currentFrameStagesTime.fill(std::chrono::nanoseconds::zero());
+
+  if (!m_isEnabled && !m_telemetryEnabled)
     return;
 
   m_startFrameRenderTime = std::chrono::steady_clock::now();
@@ -257,10 +272,15 @@ void DrapeMeasurer::AfterRenderFrame(bool isActiveFrame, m2::PointD const & view
 {
   using namespace std::chrono;
 
-  if (!m_isEnabled)
+  if (!m_isEnabled && !m_telemetryEnabled)
     return;
 
   auto const frameTime = steady_clock::now() - m_startFrameRenderTime;
+  if (m_telemetryEnabled && isActiveFrame)
+    AddFrameTelemetry(frameTime);
+
+  if (!m_isEnabled)
+    return;
   if (isActiveFrame)
   {
     if (mercator::Bounds::FullRect().IsPointInside(viewportCenter))
@@ -493,6 +513,216 @@ DrapeMeasurer::GPUMemoryStatistic DrapeMeasurer::GetGPUMemoryStatistic()
 }
 #endif
 
+void DrapeMeasurer::TimeAccumulator::Add(std::chrono::nanoseconds time)
+{
+  m_total += time;
+  m_max = std::max(m_max, time);
+}
+
+DrapeMeasurer::Telemetry::TimeStat DrapeMeasurer::TimeAccumulator::Get(uint32_t count) const
+{
+  using namespace std::chrono;
+
+  Telemetry::TimeStat stat;
+  if (count > 0)
+    stat.m_avgMs = duration<double, std::milli>(m_total).count() / count;
+  stat.m_maxMs = duration<double, std::milli>(m_max).count();
+  return stat;
+}
+
+std::string DrapeMeasurer::Telemetry::ToJSON() const
+{
+  auto const printTime = [](std::ostringstream & ss, TimeStat const & stat)
+  {
+    ss << "{\"avg_ms\":" << stat.m_avgMs << ",\"max_ms\":" << stat.m_maxMs << "}";
+  };
+
+  std::ostringstream ss;
+  ss << std::fixed << std::setprecision(3);
+  ss << "{\"period_s\":" << m_periodInSeconds;
+
+  ss << ",\"frames\":{\"count\":" << m_framesCount << ",\"slow_count\":" << m_slowFramesCount
+     << ",\"time\":";
+  printTime(ss, m_frameTime);
+  ss << "}";
+
+  char const * const kStageNames[] = {"overlays", "render_groups", "animation"};
+  static_assert(std::size(kStageNames) == static_cast<size_t>(FrameStage::Count));
+  ss << ",\"stages\":{";
+  for (size_t i = 0; i < m_stagesTime.size(); ++i)
+  {
+    ss << (i > 0 ? "," : "") << "\"" << kStageNames[i] << "\":";
+    printTime(ss, m_stagesTime[i]);
+  }
+  ss << "}";
+
+  ss << ",\"tiles\":{\"count\":" << m_tilesCount << ",\"p50_ms\":" << m_tileP50Ms
+     << ",\"p90_ms\":" << m_tileP90Ms << ",\"p99_ms\":" << m_tileP99Ms
+     << ",\"max_ms\":" << m_tileMaxMs << "}";
+
+  char const * const kThreadNames[] = {"render", "resource_upload"};
+  static_assert(std::size(kThreadNames) == ThreadsCommutator::ThreadsCount);
+  ss << ",\"queues\":{";
+  for (size_t i = 0; i < m_queues.size(); ++i)
+  {
+    ss << (i > 0 ? "," : "") << "\"" << kThreadNames[i] << "\":{\"max\":" << m_queues[i].m_maxSize
+       << ",\"last\":" << m_queues[i].m_lastSize << "}";
+  }
+  ss << "}";
+
+  // Texture uploads include glyph uploads.
+  ss << ",\"uploads\":{\"textures_count\":" << m_uploads.m_textureUploadsCount
+     << ",\"textures_bytes\":" << m_uploads.m_textureUploadedBytes
+     << ",\"glyphs_count\":" << m_uploads.m_glyphsCount
+     << ",\"glyphs_bytes\":" << m_uploads.m_glyphsUploadedBytes << "}";
+
+  ss << "}";
+  return ss.str();
+}
+
+void DrapeMeasurer::SetTelemetryEnabled(bool enabled)
+{
+  std::lock_guard lock(m_telemetryMutex);
+  if (m_telemetryEnabled == enabled)
+    return;
+
+  if (enabled)
+    ResetTelemetryImpl(std::chrono::steady_clock::now());
+  m_telemetryEnabled = enabled;
+}
+
+void DrapeMeasurer::SetTelemetryDump(std::chrono::seconds period, TelemetryListener && listener)
+{
+  std::lock_guard lock(m_telemetryMutex);
+  m_telemetryDumpPeriod = period;
+  m_telemetryListener = std::move(listener);
+}
+
+void DrapeMeasurer::AddFrameStageTime(FrameStage stage, std::chrono::nanoseconds time)
+{
+  // Stages are measured on the render thread only, like frames. They are accumulated without
+  // the lock and passed to the period telemetry once per frame in AddFrameTelemetry().
+  if (m_telemetryEnabled)
+    m_currentFrameStagesTime[static_cast<size_t>(stage)] += time;
+}
+
+void DrapeMeasurer::AddFrameTelemetry(std::chrono::nanoseconds frameTime)
+{
+  using namespace std::chrono;
+
+  auto const now = steady_clock::now();
+  Telemetry telemetry;
+  TelemetryListener listener;
+  {
+    std::lock_guard lock(m_telemetryMutex);
+    ++m_telemetryFramesCount;
+    if (frameTime > kTargetFrameTime)
+      ++m_telemetrySlowFramesCount;
+    m_telemetryFrameTime.Add(frameTime);
+    for (size_t i = 0; i < m_currentFrameStagesTime.size(); ++i)
+      m_telemetryStagesTime[i].Add(m_currentFrameStagesTime[i]);
+
+    if (m_telemetryDumpPeriod == seconds::zero() || now - m_telemetryStartTime < m_telemetryDumpPeriod)
+      return;
+
+    telemetry = GetTelemetryImpl(now);
+    ResetTelemetryImpl(now);
+    listener = m_telemetryListener;
+  }
+
+  auto const json = telemetry.ToJSON();
+  if (listener)
+    listener(json);
+  else
+    LOG(LINFO, ("Drape telemetry:", json));
+}
+
+void DrapeMeasurer::AddTileBuildTime(std::chrono::nanoseconds time)
+{
+  if (!m_telemetryEnabled)
+    return;
+
+  std::lock_guard lock(m_telemetryMutex);
+  if (m_tileBuildTimes.size() < kMaxTileSamplesCount)
+    m_tileBuildTimes.push_back(time);
+  else
+    m_tileBuildTimes[m_telemetryTilesCount % kMaxTileSamplesCount] = time;
+  ++m_telemetryTilesCount;
+}
+
+void DrapeMeasurer::AddMessageQueueSize(ThreadsCommutator::ThreadName thread, size_t size)
+{
+  if (!m_telemetryEnabled)
+    return;
+
+  ASSERT_LESS(thread, ThreadsCommutator::ThreadsCount, ());
+  std::lock_guard lock(m_telemetryMutex);
+  auto & stat = m_telemetryQueues[thread];
+  stat.m_lastSize = static_cast<uint32_t>(size);
+  stat.m_maxSize = std::max(stat.m_maxSize, stat.m_lastSize);
+}
+
+DrapeMeasurer::Telemetry DrapeMeasurer::GetTelemetry() const
+{
+  std::lock_guard lock(m_telemetryMutex);
+  return GetTelemetryImpl(std::chrono::steady_clock::now());
+}
+
+DrapeMeasurer::Telemetry DrapeMeasurer::GetTelemetryImpl(std::chrono::steady_clock::time_point now) const
+{
+  using namespace std::chrono;
+
+  Telemetry telemetry;
+  telemetry.m_periodInSeconds = duration<double>(now - m_telemetryStartTime).count();
+
+  telemetry.m_framesCount = m_telemetryFramesCount;
+  telemetry.m_slowFramesCount = m_telemetrySlowFramesCount;
+  telemetry.m_frameTime = m_telemetryFrameTime.Get(m_telemetryFramesCount);
+  for (size_t i = 0; i < m_telemetryStagesTime.size(); ++i)
+    telemetry.m_stagesTime[i] = m_telemetryStagesTime[i].Get(m_telemetryFramesCount);
+
+  telemetry.m_tilesCount = m_telemetryTilesCount;
+  if (!m_tileBuildTimes.empty())
+  {
+    auto times = m_tileBuildTimes;
+    std::sort(times.begin(), times.end());
+    auto const percentile = [&times](double p)
+    {
+      auto const index = static_cast<size_t>(std::ceil(p * times.size()));
+      return duration<double, std::milli>(times[std::max(index, size_t(1)) - 1]).count();
+    };
+    telemetry.m_tileP50Ms = percentile(0.5);
+    telemetry.m_tileP90Ms = percentile(0.9);
+    telemetry.m_tileP99Ms = percentile(0.99);
+    telemetry.m_tileMaxMs = duration<double, std::milli>(times.back()).count();
+  }
+
+  telemetry.m_queues = m_telemetryQueues;
+
+  auto const uploads = dp::TextureUploadTracker::Instance().GetSnapshot();
+  telemetry.m_uploads.m_textureUploadsCount =
+      uploads.m_textureUploadsCount - m_telemetryUploadsStart.m_textureUploadsCount;
+  telemetry.m_uploads.m_textureUploadedBytes =
+      uploads.m_textureUploadedBytes - m_telemetryUploadsStart.m_textureUploadedBytes;
+  telemetry.m_uploads.m_glyphsCount = uploads.m_glyphsCount - m_telemetryUploadsStart.m_glyphsCount;
+  telemetry.m_uploads.m_glyphsUploadedBytes =
+      uploads.m_glyphsUploadedBytes - m_telemetryUploadsStart.m_glyphsUploadedBytes;
+  return telemetry;
+}
+
+void DrapeMeasurer::ResetTelemetryImpl(std::chrono::steady_clock::time_point now)
+{
+  m_telemetryStartTime = now;
+  m_telemetryFramesCount = 0;
+  m_telemetrySlowFramesCount = 0;
+  m_telemetryFrameTime = {};
+  m_telemetryStagesTime = {};
+  m_tileBuildTimes.clear();
+  m_telemetryTilesCount = 0;
+  m_telemetryQueues = {};
+  m_telemetryUploadsStart = dp::TextureUploadTracker::Instance().GetSnapshot();
+}
+
 std::string DrapeMeasurer::DrapeStatistic::ToString() const
 {
   std::ostringstream ss;
@@ -1,15 +1,21 @@
 #pragma once
 
+#include "drape_frontend/threads_commutator.hpp"
+
 #include "drape/drape_diagnostics.hpp"
 #include "drape/utils/gpu_mem_tracker.hpp"
 #include "drape/utils/glyph_usage_tracker.hpp"
+#include "drape/utils/texture_upload_tracker.hpp"
 
 #include "geometry/rect2d.hpp"
 
 #include "base/thread.hpp"
 #include "base/timer.hpp"
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -132,9 +138,74 @@ public:
 
   DrapeStatistic GetDrapeStatistic();
 
+  /// Runtime telemetry. Unlike the statistics above it's available in production builds,
+  /// it's disabled by default and doesn't depend on Start()/Stop().
+  enum class FrameStage : uint8_t
+  {
+    Overlays,
+    RenderGroups,
+    Animation,
+
+    Count
+  };
+
+  struct Telemetry
+  {
+    struct TimeStat
+    {
+      double m_avgMs = 0.0;
+      double m_maxMs = 0.0;
+    };
+
+    struct QueueStat
+    {
+      uint32_t m_maxSize = 0;
+      uint32_t m_lastSize = 0;
+    };
+
+    std::string ToJSON() const;
+
+    double m_periodInSeconds = 0.0;
+
+    uint32_t m_framesCount = 0;
+    uint32_t m_slowFramesCount = 0;
+    TimeStat m_frameTime;
+    // Exclusive CPU time of the frame stages per frame.
+    std::array<TimeStat, static_cast<size_t>(FrameStage::Count)> m_stagesTime;
+
+    uint32_t m_tilesCount = 0;
+    double m_tileP50Ms = 0.0;
+    double m_tileP90Ms = 0.0;
+    double m_tileP99Ms = 0.0;
+    double m_tileMaxMs = 0.0;
+
+    std::array<QueueStat, ThreadsCommutator::ThreadsCount> m_queues;
+
+    dp::TextureUploadTracker::Snapshot m_uploads;
+  };
+
+  using TelemetryListener = std::function<void(std::string const & json)>;
+
+  void SetTelemetryEnabled(bool enabled);
+  bool IsTelemetryEnabled() const { return m_telemetryEnabled; }
+  /// Telemetry of every |period| is dumped as JSON to |listener| (to the log if it's empty).
+  /// Zero |period| disables dumping.
+  void SetTelemetryDump(std::chrono::seconds period, TelemetryListener && listener);
+
+  void AddFrameStageTime(FrameStage stage, std::chrono::nanoseconds time);
+  void AddTileBuildTime(std::chrono::nanoseconds time);
+  void AddMessageQueueSize(ThreadsCommutator::ThreadName thread, size_t size);
+
+  /// \returns telemetry of the current period (since enabling or the last dump).
+  Telemetry GetTelemetry() const;
+
 private:
   DrapeMeasurer() = default;
 
+  void AddFrameTelemetry(std::chrono::nanoseconds frameTime);
+  Telemetry GetTelemetryImpl(std::chrono::steady_clock::time_point now) const;
+  void ResetTelemetryImpl(std::chrono::steady_clock::time_point now);
+
   dp::ApiVersion m_apiVersion = dp::ApiVersion::Invalid;
   m2::PointU m_resolution;
   std::string m_gpuName;
@@ -166,6 +237,33 @@ private:
 
   std::chrono::time_point<std::chrono::steady_clock> m_startFrameRenderTime;
 
+  struct TimeAccumulator
+  {
+    void Add(std::chrono::nanoseconds time);
+    Telemetry::TimeStat Get(uint32_t count) const;
+
+    std::chrono::nanoseconds m_total = {};
+    std::chrono::nanoseconds m_max = {};
+  };
+
+  std::atomic<bool> m_telemetryEnabled = false;
+  mutable std::mutex m_telemetryMutex;
+  std::chrono::steady_clock::time_point m_telemetryStartTime;
+  std::chrono::seconds m_telemetryDumpPeriod = {};
+  TelemetryListener m_telemetryListener;
+  uint32_t m_telemetryFramesCount = 0;
+  uint32_t m_telemetrySlowFramesCount = 0;
+  TimeAccumulator m_telemetryFrameTime;
+  // Stages time of the current frame. It's used on the render thread only and reset in BeforeRenderFrame().
+  std::array<std::chrono::nanoseconds, static_cast<size_t>(FrameStage::Count)> m_currentFrameStagesTime = {};
+  std::array<TimeAccumulator, static_cast<size_t>(FrameStage::Count)> m_telemetryStagesTime;
+  // Latencies of the last kMaxTileSamplesCount tiles of the period are kept for percentiles.
+  static size_t constexpr kMaxTileSamplesCount = 1024;
+  std::vector<std::chrono::nanoseconds> m_tileBuildTimes;
+  uint32_t m_telemetryTilesCount = 0;
+  std::array<Telemetry::QueueStat, ThreadsCommutator::ThreadsCount> m_telemetryQueues;
+  dp::TextureUploadTracker::Snapshot m_telemetryUploadsStart;
+
   std::chrono::nanoseconds m_realtimeMinFrameRenderTime;
   std::chrono::nanoseconds m_realtimeMaxFrameRenderTime;
   std::chrono::nanoseconds m_realtimeTotalFrameRenderTime;
@@ -11,6 +11,7 @@ EngineContext::EngineContext(TileKey tileKey,
                              ref_ptr<ThreadsCommutator> commutator,
                              ref_ptr<dp::TextureManager> texMng,
                              ref_ptr<MetalineManager> metalineMng,
+                             ref_ptr<BuildingsGeometryCache> buildingsGeometryCache,
                              CustomFeaturesContextWeakPtr customFeaturesContext,
                              bool is3dBuildingsEnabled,
                              bool isTrafficEnabled,
@@ -19,6 +20,7 @@ EngineContext::EngineContext(TileKey tileKey,
   , m_commutator(commutator)
   , m_texMng(texMng)
   , m_metalineMng(metalineMng)
+  , m_buildingsGeometryCache(buildingsGeometryCache)
   , m_customFeaturesContext(customFeaturesContext)
   , m_3dBuildingsEnabled(is3dBuildingsEnabled)
   , m_trafficEnabled(isTrafficEnabled)
@@ -18,6 +18,7 @@ class TextureManager;
 
 namespace df
 {
+class BuildingsGeometryCache;
 class Message;
 class MetalineManager;
 
@@ -28,6 +29,7 @@ public:
                 ref_ptr<ThreadsCommutator> commutator,
                 ref_ptr<dp::TextureManager> texMng,
                 ref_ptr<MetalineManager> metalineMng,
+                ref_ptr<BuildingsGeometryCache> buildingsGeometryCache,
                 CustomFeaturesContextWeakPtr customFeaturesContext,
                 bool is3dBuildingsEnabled,
                 bool isTrafficEnabled,
@@ -40,6 +42,7 @@ public:
   CustomFeaturesContextWeakPtr GetCustomFeaturesContext() const { return m_customFeaturesContext; }
   ref_ptr<dp::TextureManager> GetTextureManager() const;
   ref_ptr<MetalineManager> GetMetalineManager() const;
+  ref_ptr<BuildingsGeometryCache> GetBuildingsGeometryCache() const { return m_buildingsGeometryCache; }
 
   void BeginReadTile();
   void Flush(TMapShapes && shapes);
@@ -54,6 +57,7 @@ private:
   ref_ptr<ThreadsCommutator> m_commutator;
   ref_ptr<dp::TextureManager> m_texMng;
   ref_ptr<MetalineManager> m_metalineMng;
+  ref_ptr<BuildingsGeometryCache> m_buildingsGeometryCache;
   CustomFeaturesContextWeakPtr m_customFeaturesContext;
   bool m_3dBuildingsEnabled;
   bool m_trafficEnabled;
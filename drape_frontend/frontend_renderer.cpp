@@ -130,6 +130,47 @@ private:
   m2::PointD m_viewportCenter = m2::PointD::Zero();
 };
 
+// Measures exclusive time of a frame stage: time of nested stages is subtracted.
+class FrameStageMeasurerGuard
+{
+public:
+  explicit FrameStageMeasurerGuard(DrapeMeasurer::FrameStage stage)
+    : m_stage(stage)
+    , m_isEnabled(DrapeMeasurer::Instance().IsTelemetryEnabled())
+  {
+    if (!m_isEnabled)
+      return;
+
+    m_parent = s_current;
+    s_current = this;
+    m_startTime = std::chrono::steady_clock::now();
+  }
+
+  ~FrameStageMeasurerGuard()
+  {
+    if (!m_isEnabled)
+      return;
+
+    auto const time = std::chrono::steady_clock::now() - m_startTime;
+    s_current = m_parent;
+    if (m_parent != nullptr)
+      m_parent->m_nestedTime += time;
+    DrapeMeasurer::Instance().AddFrameStageTime(m_stage, time - m_nestedTime);
+  }
+
+private:
+  // Stages are measured on the render thread only.
+  static FrameStageMeasurerGuard * s_current;
+
+  DrapeMeasurer::FrameStage const m_stage;
+  bool const m_isEnabled;
+  FrameStageMeasurerGuard * m_parent = nullptr;
+  std::chrono::steady_clock::time_point m_startTime;
+  std::chrono::nanoseconds m_nestedTime = {};
+};
+
+FrameStageMeasurerGuard * FrameStageMeasurerGuard::s_current = nullptr;
+
 #if defined(DRAPE_MEASURER_BENCHMARK) && (defined(RENDER_STATISTIC) || defined(TRACK_GPU_MEM))
 class DrapeImmediateRenderingMeasurerGuard
 {
@@ -1404,6 +1445,7 @@ void FrontendRenderer::EndUpdateOverlayTree()
 void FrontendRenderer::RenderScene(ScreenBase const & modelView, bool activeFrame)
 {
   CHECK(m_context != nullptr, ());
+  FrameStageMeasurerGuard stageGuard(DrapeMeasurer::FrameStage::RenderGroups);
 #if defined(DRAPE_MEASURER_BENCHMARK) && (defined(RENDER_STATISTIC) || defined(TRACK_GPU_MEM))
   DrapeImmediateRenderingMeasurerGuard drapeMeasurerGuard(m_context);
 #endif
@@ -1775,8 +1817,11 @@ void FrontendRenderer::RenderFrame()
   if (modelViewChanged || hasForceUpdate)
     UpdateScene(modelView);
 
-  InterpolationHolder::Instance().Advance(m_frameData.m_frameTime);
-  AnimationSystem::Instance().Advance(m_frameData.m_frameTime);
+  {
+    FrameStageMeasurerGuard stageGuard(DrapeMeasurer::FrameStage::Animation);
+    InterpolationHolder::Instance().Advance(m_frameData.m_frameTime);
+    AnimationSystem::Instance().Advance(m_frameData.m_frameTime);
+  }
 
   // On the first inactive frame we invalidate overlay tree.
   if (!isActiveFrame)
@@ -1854,6 +1899,7 @@ void FrontendRenderer::BuildOverlayTree(ScreenBase const & modelView)
   if (!IsValidCurrentZoom())
     return;
 
+  FrameStageMeasurerGuard stageGuard(DrapeMeasurer::FrameStage::Overlays);
   BeginUpdateOverlayTree(modelView);
   for (auto const layerId : {DepthLayer::OverlayLayer,
                              DepthLayer::RoutingBottomMarkLayer,
@@ -0,0 +1,135 @@
+#include "drape_frontend/gps_track_levels.hpp"
+
+#include "base/assert.hpp"
+
+#include <algorithm>
+
+namespace df
+{
+namespace
+{
+// About a meter, it's less than a pixel on the most detailed zoom levels.
+double constexpr kMinTolerance = 1e-5;
+double constexpr kTolerancesFactor = 4.0;
+size_t constexpr kLevelsCount = 8;
+}  // namespace
+
+GpsTrackLevels::GpsTrackLevels()
+{
+  m_levels.reserve(kLevelsCount);
+  m_levels.emplace_back(0.0 /* tolerance */);
+  double tolerance = kMinTolerance;
+  while (m_levels.size() < kLevelsCount)
+  {
+    m_levels.emplace_back(tolerance);
+    tolerance *= kTolerancesFactor;
+  }
+}
+
+void GpsTrackLevels::Append(std::vector<GpsTrackPoint> const & points)
+{
+  for (auto const & pt : points)
+  {
+    auto const & allPoints = m_levels.front().m_points;
+    ASSERT(allPoints.empty() || allPoints.back().m_id < pt.m_id, ());
+    // Copy the previous point, because the level 0 is changed in the loop.
+    GpsTrackPoint prevPt;
+    bool const hasPrevPt = !allPoints.empty();
+    if (hasPrevPt)
+      prevPt = allPoints.back();
+
+    for (auto & level : m_levels)
+      Append(level, pt, hasPrevPt ? &prevPt : nullptr);
+  }
+}
+
+// static
+void GpsTrackLevels::Append(Level & level, GpsTrackPoint const & pt, GpsTrackPoint const * prevPt)
+{
+  auto & points = level.m_points;
+  bool const isTimeGap = prevPt != nullptr && pt.m_timestamp - prevPt->m_timestamp > kTimeGapSec;
+
+  // The previous point of the track stays on the level before a time gap.
+  if (!points.empty() && !level.m_isLastFixed && !isTimeGap)
+  {
+    points.pop_back();
+    level.m_isSplineValid = false;
+  }
+
+  level.m_isLastFixed = points.empty() || isTimeGap ||
+                        points.back().m_point.Length(pt.m_point) >= level.m_tolerance;
+  points.push_back(pt);
+
+  if (level.m_isSplineValid)
+    level.m_spline.AddPoint(pt.m_point);
+}
+
+void GpsTrackLevels::Remove(std::vector<uint32_t> const & ids)
+{
+  if (ids.empty())
+    return;
+
+  ASSERT(std::is_sorted(ids.begin(), ids.end()), ());
+  for (auto & level : m_levels)
+  {
+    auto & points = level.m_points;
+    auto const it = std::remove_if(points.begin(), points.end(), [&ids](GpsTrackPoint const & pt)
+    {
+      return std::binary_search(ids.begin(), ids.end(), pt.m_id);
+    });
+
+    if (it != points.end())
+    {
+      points.erase(it, points.end());
+      level.m_isSplineValid = false;
+      if (points.empty())
+        level.m_isLastFixed = false;
+    }
+  }
+}
+
+void GpsTrackLevels::Clear()
+{
+  for (auto & level : m_levels)
+  {
+    level.m_points.clear();
+    level.m_isLastFixed = false;
+    level.m_spline.Clear();
+    level.m_isSplineValid = true;
+  }
+}
+
+size_t GpsTrackLevels::GetLevel(double tolerance) const
+{
+  size_t level = 0;
+  while (level + 1 < m_levels.size() && m_levels[level + 1].m_tolerance <= tolerance)
+    ++level;
+  return level;
+}
+
+double GpsTrackLevels::GetTolerance(size_t level) const
+{
+  ASSERT_LESS(level, m_levels.size(), ());
+  return m_levels[level].m_tolerance;
+}
+
+std::vector<GpsTrackPoint> const & GpsTrackLevels::GetPoints(size_t level) const
+{
+  ASSERT_LESS(level, m_levels.size(), ());
+  return m_levels[level].m_points;
+}
+
+m2::Spline const & GpsTrackLevels::GetSpline(size_t level)
+{
+  ASSERT_LESS(level, m_levels.size(), ());
+  auto & l = m_levels[level];
+  if (!l.m_isSplineValid)
+  {
+    l.m_spline.Clear();
+    for (auto const & pt : l.m_points)
+      l.m_spline.AddPoint(pt.m_point);
+    l.m_isSplineValid = true;
+  }
+  return l.m_spline;
+}
+}  // namespace df
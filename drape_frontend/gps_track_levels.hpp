@@ -0,0 +1,60 @@
+#pragma once
+
+#include "drape_frontend/gps_track_point.hpp"
+
+#include "geometry/spline.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace df
+{
+/// Multi-resolution copy of the gps track. The level 0 keeps all points, every next level keeps
+/// a point if it is farther than the level tolerance from the previous kept one (radial distance
+/// simplification), tolerances grow kTolerancesFactor times per level. The last point of a level
+/// is always the last point of the track, it's replaced by the next point while it's too close
+/// to the previous kept one. Points around time gaps are kept too, so gaps are drawn on all levels.
+/// Appending of a point takes O(levels count).
+class GpsTrackLevels
+{
+public:
+  // Points farther in time are not connected by the track.
+  static double constexpr kTimeGapSec = 5 * 60;
+
+  GpsTrackLevels();
+
+  // Points must be sorted by id and follow already added ones.
+  void Append(std::vector<GpsTrackPoint> const & points);
+  // Ids must be sorted.
+  void Remove(std::vector<uint32_t> const & ids);
+  void Clear();
+
+  bool IsEmpty() const { return m_levels.front().m_points.empty(); }
+  size_t GetLevelsCount() const { return m_levels.size(); }
+
+  /// \returns The coarsest level which tolerance in mercator doesn't exceed |tolerance|.
+  size_t GetLevel(double tolerance) const;
+  double GetTolerance(size_t level) const;
+  std::vector<GpsTrackPoint> const & GetPoints(size_t level) const;
+  // The spline of a level is rebuilt on demand after the level changing.
+  m2::Spline const & GetSpline(size_t level);
+
+private:
+  struct Level
+  {
+    explicit Level(double tolerance) : m_tolerance(tolerance) {}
+
+    double m_tolerance;
+    std::vector<GpsTrackPoint> m_points;
+    // False if the last point may be replaced by the next one.
+    bool m_isLastFixed = false;
+    m2::Spline m_spline;
+    bool m_isSplineValid = true;
+  };
+
+  static void Append(Level & level, GpsTrackPoint const & pt, GpsTrackPoint const * prevPt);
+
+  std::vector<Level> m_levels;
+};
+}  // namespace df
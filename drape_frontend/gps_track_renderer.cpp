@@ -26,6 +26,9 @@ int const kMinVisibleZoomLevel = 5;
 
 uint32_t const kAveragePointsCount = 512;
 
+// A simplification error of a track level is invisible if it's small in comparison to circles.
+double const kLevelToleranceInRadius = 0.5;
+
 // Radius of circles depending on zoom levels.
 std::array<float, 20> const kRadiusInPixel =
 {
@@ -41,8 +44,6 @@ uint8_t const kMinDayAlpha = 90;
 uint8_t const kMaxDayAlpha = 144;
 uint8_t const kMinNightAlpha = 50;
 uint8_t const kMaxNightAlpha = 102;
-double const kUnknownDistanceTime = 5 * 60; // seconds
-
 double const kDistanceScalar = 0.4;
 
 #ifdef DEBUG
@@ -60,7 +61,6 @@ GpsTrackRenderer::GpsTrackRenderer(TRenderDataRequestFn const & dataRequestFn)
   , m_radius(0.0f)
 {
   ASSERT(m_dataRequestFn != nullptr, ());
-  m_points.reserve(kAveragePointsCount);
   m_handlesCache.reserve(8);
 }
 
@@ -87,31 +87,13 @@ void GpsTrackRenderer::ClearRenderData()
 void GpsTrackRenderer::UpdatePoints(std::vector<GpsTrackPoint> const & toAdd,
                                     std::vector<uint32_t> const & toRemove)
 {
-  bool wasChanged = false;
-  if (!toRemove.empty())
-  {
-    auto removePredicate = [&toRemove](GpsTrackPoint const & pt)
-    {
-      return base::IsExist(toRemove, pt.m_id);
-    };
-    m_points.erase(std::remove_if(m_points.begin(), m_points.end(), removePredicate),
-                   m_points.end());
-    wasChanged = true;
-  }
+  // Removed points are a sorted range of ids.
+  m_levels.Remove(toRemove);
 
   if (!toAdd.empty())
   {
     ASSERT(is_sorted(toAdd.begin(), toAdd.end(), GpsPointsSortPredicate), ());
-    ASSERT(m_points.empty() || GpsPointsSortPredicate(m_points.back(), toAdd.front()), ());
-    m_points.insert(m_points.end(), toAdd.begin(), toAdd.end());
-    wasChanged = true;
-  }
-
-  if (wasChanged)
-  {
-    m_pointsSpline = m2::Spline(m_points.size());
-    for (size_t i = 0; i < m_points.size(); i++)
-      m_pointsSpline.AddPoint(m_points[i].m_point);
+    m_levels.Append(toAdd);
   }
 
   m_needUpdate = true;
@@ -126,15 +108,16 @@ size_t GpsTrackRenderer::GetAvailablePointsCount() const
   return pointsCount;
 }
 
-dp::Color GpsTrackRenderer::CalculatePointColor(size_t pointIndex, m2::PointD const & curPoint,
+dp::Color GpsTrackRenderer::CalculatePointColor(std::vector<GpsTrackPoint> const & points,
+                                                size_t pointIndex, m2::PointD const & curPoint,
                                                 double lengthFromStart, double fullLength) const
 {
-  ASSERT_LESS(pointIndex, m_points.size(), ());
-  if (pointIndex + 1 == m_points.size())
+  ASSERT_LESS(pointIndex, points.size(), ());
+  if (pointIndex + 1 == points.size())
     return dp::Color::Transparent();
 
-  GpsTrackPoint const & start = m_points[pointIndex];
-  GpsTrackPoint const & end = m_points[pointIndex + 1];
+  GpsTrackPoint const & start = points[pointIndex];
+  GpsTrackPoint const & end = points[pointIndex + 1];
 
   double startAlpha = kMinDayAlpha;
   double endAlpha = kMaxDayAlpha;
@@ -148,7 +131,7 @@ dp::Color GpsTrackRenderer::CalculatePointColor(size_t pointIndex, m2::PointD co
   double const ta = base::Clamp(lengthFromStart / fullLength, 0.0, 1.0);
   double const alpha = startAlpha * (1.0 - ta) + endAlpha * ta;
 
-  if ((end.m_timestamp - start.m_timestamp) > kUnknownDistanceTime)
+  if ((end.m_timestamp - start.m_timestamp) > GpsTrackLevels::kTimeGapSec)
   {
     dp::Color const color = df::GetColorConstant(df::kTrackUnknownDistanceColor);
     return dp::Color(color.GetRed(), color.GetGreen(), color.GetBlue(),
@@ -184,7 +167,7 @@ void GpsTrackRenderer::RenderTrack(ref_ptr<dp::GraphicsContext> context, ref_ptr
   if (m_needUpdate)
   {
     // Skip rendering if there is no any point.
-    if (m_points.empty())
+    if (m_levels.IsEmpty())
     {
       m_needUpdate = false;
       return;
@@ -219,18 +202,22 @@ void GpsTrackRenderer::RenderTrack(ref_ptr<dp::GraphicsContext> context, ref_ptr
 
     m_pivot = screen.GlobalRect().Center();
 
+    // Take the coarsest level of the track which differs from the full one less than circles do.
+    size_t const level = m_levels.GetLevel(kLevelToleranceInRadius * radiusMercator);
+    auto const & points = m_levels.GetPoints(level);
+
     size_t cacheIndex = 0;
-    if (m_points.size() == 1)
+    if (points.size() == 1)
     {
-      dp::Color const color = GetColorBySpeed(m_points.front().m_speedMPS);
-      m2::PointD const pt = MapShape::ConvertToLocal(m_points.front().m_point, m_pivot, kShapeCoordScalar);
+      dp::Color const color = GetColorBySpeed(points.front().m_speedMPS);
+      m2::PointD const pt = MapShape::ConvertToLocal(points.front().m_point, m_pivot, kShapeCoordScalar);
       m_handlesCache[cacheIndex].first->SetPoint(0, pt, m_radius, color);
       m_handlesCache[cacheIndex].second++;
     }
     else
     {
       m2::Spline::iterator it;
-      it.Attach(m_pointsSpline);
+      it.Attach(m_levels.GetSpline(level));
       while (!it.BeginAgain())
       {
         m2::PointD const pt = it.m_pos;
@@ -238,7 +225,7 @@ void GpsTrackRenderer::RenderTrack(ref_ptr<dp::GraphicsContext> context, ref_ptr
                             pt.x + radiusMercator, pt.y + radiusMercator);
         if (screen.ClipRect().IsIntersect(pointRect))
         {
-          dp::Color const color = CalculatePointColor(it.GetIndex(), pt,
+          dp::Color const color = CalculatePointColor(points, it.GetIndex(), pt,
                                                       it.GetLength(), it.GetFullLength());
           m2::PointD const convertedPt = MapShape::ConvertToLocal(pt, m_pivot, kShapeCoordScalar);
           m_handlesCache[cacheIndex].first->SetPoint(m_handlesCache[cacheIndex].second,
@@ -258,9 +245,10 @@ void GpsTrackRenderer::RenderTrack(ref_ptr<dp::GraphicsContext> context, ref_ptr
       }
 
 #ifdef GPS_TRACK_SHOW_RAW_POINTS
-      for (size_t i = 0; i < m_points.size(); i++)
+      auto const & rawPoints = m_levels.GetPoints(0 /* level */);
+      for (size_t i = 0; i < rawPoints.size(); i++)
       {
-        m2::PointD const convertedPt = MapShape::ConvertToLocal(m_points[i].m_point, m_pivot, kShapeCoordScalar);
+        m2::PointD const convertedPt = MapShape::ConvertToLocal(rawPoints[i].m_point, m_pivot, kShapeCoordScalar);
         m_handlesCache[cacheIndex].first->SetPoint(m_handlesCache[cacheIndex].second, convertedPt,
                                                    m_radius * 1.2, dp::Color(0, 0, 255, 255));
         m_handlesCache[cacheIndex].second++;
@@ -311,7 +299,7 @@ void GpsTrackRenderer::Update()
 
 void GpsTrackRenderer::Clear()
 {
-  m_points.clear();
+  m_levels.Clear();
   m_needUpdate = true;
 }
 }  // namespace df
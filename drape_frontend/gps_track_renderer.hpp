@@ -2,6 +2,7 @@
 
 #include "drape_frontend/circles_pack_shape.hpp"
 #include "drape_frontend/frame_values.hpp"
+#include "drape_frontend/gps_track_levels.hpp"
 #include "drape_frontend/gps_track_point.hpp"
 
 #include "shaders/program_manager.hpp"
@@ -10,7 +11,6 @@
 #include "drape/pointers.hpp"
 
 #include "geometry/screenbase.hpp"
-#include "geometry/spline.hpp"
 
 #include <functional>
 #include <map>
@@ -39,14 +39,14 @@ public:
 
 private:
   size_t GetAvailablePointsCount() const;
-  dp::Color CalculatePointColor(size_t pointIndex, m2::PointD const & curPoint,
-                                double lengthFromStart, double fullLength) const;
+  dp::Color CalculatePointColor(std::vector<GpsTrackPoint> const & points, size_t pointIndex,
+                                m2::PointD const & curPoint, double lengthFromStart,
+                                double fullLength) const;
   dp::Color GetColorBySpeed(double speed) const;
 
   TRenderDataRequestFn m_dataRequestFn;
   std::vector<drape_ptr<CirclesPackRenderData>> m_renderData;
-  std::vector<GpsTrackPoint> m_points;
-  m2::Spline m_pointsSpline;
+  GpsTrackLevels m_levels;
   bool m_needUpdate;
   bool m_waitForRenderData;
   std::vector<std::pair<CirclesPackHandle *, size_t>> m_handlesCache;
@@ -57,6 +57,11 @@ bool MessageAcceptor::IsInInfinityWaiting() const
   return m_infinityWaiting;
 }
 
+size_t MessageAcceptor::GetQueueSize() const
+{
+  return m_messageQueue.GetSize();
+}
+
 #ifdef DEBUG_MESSAGE_QUEUE
 
 bool MessageAcceptor::IsQueueEmpty() const
@@ -64,10 +69,5 @@ bool MessageAcceptor::IsQueueEmpty() const
   return m_messageQueue.IsEmpty();
 }
 
-size_t MessageAcceptor::GetQueueSize() const
-{
-  return m_messageQueue.GetSize();
-}
-
 #endif
 }  // namespace df
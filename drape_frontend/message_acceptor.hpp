@@ -29,9 +29,9 @@ protected:
 
   bool IsInInfinityWaiting() const;
 
+  size_t GetQueueSize() const;
 #ifdef DEBUG_MESSAGE_QUEUE
   bool IsQueueEmpty() const;
-  size_t GetQueueSize() const;
 #endif
 
   void EnableMessageFiltering(MessageQueue::FilterMessageFn && filter);
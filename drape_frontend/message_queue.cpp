@@ -133,17 +133,17 @@ void MessageQueue::InstantFilter(FilterMessageFn && filter)
   m_filter = nullptr;
 }
 
-#ifdef DEBUG_MESSAGE_QUEUE
-bool MessageQueue::IsEmpty() const
+size_t MessageQueue::GetSize() const
 {
   std::lock_guard<std::mutex> lock(m_mutex);
-  return m_messages.empty() && m_lowPriorityMessages.empty();
+  return m_messages.size() + m_lowPriorityMessages.size();
 }
 
-size_t MessageQueue::GetSize() const
+#ifdef DEBUG_MESSAGE_QUEUE
+bool MessageQueue::IsEmpty() const
 {
   std::lock_guard<std::mutex> lock(m_mutex);
-  return m_messages.size() + m_lowPriorityMessages.size();
+  return m_messages.empty() && m_lowPriorityMessages.empty();
 }
 #endif
 
@@ -29,9 +29,9 @@ public:
   void DisableMessageFiltering();
   void InstantFilter(FilterMessageFn && filter);
 
+  size_t GetSize() const;
 #ifdef DEBUG_MESSAGE_QUEUE
   bool IsEmpty() const;
-  size_t GetSize() const;
 #endif
 
 private:
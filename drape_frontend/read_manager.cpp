@@ -6,7 +6,10 @@
 #include "base/buffer_vector.hpp"
 
 #include <algorithm>
+#include <cstdlib>
 #include <functional>
+#include <thread>
+#include <utility>
 
 namespace df
 {
@@ -32,8 +35,21 @@ struct LessCoverageCell
     return l->GetTileKey() < r->GetTileKey();
   }
 };
+
+uint8_t constexpr kMinReadingThreadsCount = 2;
+uint8_t constexpr kMaxReadingThreadsCount = 4;
 }  // namespace
 
+uint8_t GetReadingThreadsCount()
+{
+  // Frontend, backend and UI threads are busy during rendering too,
+  // so only a half of the cores is used for reading.
+  static uint8_t const count = static_cast<uint8_t>(
+      std::clamp(std::thread::hardware_concurrency() / 2, static_cast<unsigned>(kMinReadingThreadsCount),
+                 static_cast<unsigned>(kMaxReadingThreadsCount)));
+  return count;
+}
+
 bool ReadManager::LessByTileInfo::operator()(std::shared_ptr<TileInfo> const & l,
                                              std::shared_ptr<TileInfo> const & r) const
 {
@@ -64,7 +80,7 @@ void ReadManager::Start()
 
   ASSERT_EQUAL(m_counter, 0, ());
 
-  m_pool = make_unique_dp<base::ThreadPool>(kReadingThreadsCount,
+  m_pool = make_unique_dp<base::ThreadPool>(GetReadingThreadsCount(),
                               std::bind(&ReadManager::OnTaskFinished, this, std::placeholders::_1));
 }
 
@@ -74,6 +90,7 @@ void ReadManager::Stop()
   if (m_pool != nullptr)
     m_pool->Stop();
   m_pool.reset();
+  m_buildingsGeometryCache.Clear();
 }
 
 void ReadManager::Restart()
@@ -144,8 +161,7 @@ void ReadManager::UpdateCoverage(ScreenBase const & screen, bool have3dBuildings
     ++m_generationCounter;
     ++m_userMarksGenerationCounter;
 
-    for (auto const & tileKey : tiles)
-      PushTaskBackForTileKey(tileKey, texMng, metalineMng);
+    PushTasksByPriority(screen, tiles, texMng, metalineMng);
   }
   else
   {
@@ -176,8 +192,8 @@ void ReadManager::UpdateCoverage(ScreenBase const & screen, bool have3dBuildings
       ++m_userMarksGenerationCounter;
     CheckFinishedTiles(readyTiles, forceUpdateUserMarks);
 
-    for (auto const & tileKey : newTiles)
-      PushTaskBackForTileKey(tileKey, texMng, metalineMng);
+    // Outdated tiles are cancelled above, so their tasks are dropped by the pool without reading.
+    PushTasksByPriority(screen, newTiles, texMng, metalineMng);
   }
 
   m_currentViewport = screen;
@@ -233,6 +249,7 @@ void ReadManager::PushTaskBackForTileKey(TileKey const & tileKey,
   auto context = make_unique_dp<EngineContext>(TileKey(tileKey, m_generationCounter,
                                                        m_userMarksGenerationCounter),
                                                m_commutator, texMng, metalineMng,
+                                               make_ref(&m_buildingsGeometryCache),
                                                m_customFeaturesContext,
                                                m_have3dBuildings && m_allow3dBuildings,
                                                m_trafficEnabled, m_isolinesEnabled);
@@ -252,6 +269,32 @@ void ReadManager::PushTaskBackForTileKey(TileKey const & tileKey,
   m_pool->PushBack(task);
 }
 
+template <typename TilesT>
+void ReadManager::PushTasksByPriority(ScreenBase const & screen, TilesT const & tiles,
+                                      ref_ptr<dp::TextureManager> texMng,
+                                      ref_ptr<MetalineManager> metalineMng)
+{
+  // Tiles of the current zoom level which are closer to the screen center are read first,
+  // so the center of the screen is not delayed by the tiles at the edges during fast pans and zooms.
+  m2::PointD const & center = screen.GetOrg();
+  int const zoomLevel = df::GetDrawTileScale(screen);
+
+  using Priority = std::pair<int, double>;
+  buffer_vector<std::pair<Priority, TileKey>, 16> queue;
+  queue.reserve(tiles.size());
+  for (auto const & tileKey : tiles)
+  {
+    Priority const priority(std::abs(tileKey.m_zoomLevel - zoomLevel),
+                            tileKey.GetGlobalRect(false /* clipByDataMaxZoom */).Center().SquaredLength(center));
+    queue.emplace_back(priority, tileKey);
+  }
+
+  std::sort(queue.begin(), queue.end(), [](auto const & l, auto const & r) { return l.first < r.first; });
+
+  for (auto const & p : queue)
+    PushTaskBackForTileKey(p.second, texMng, metalineMng);
+}
+
 void ReadManager::CheckFinishedTiles(TTileInfoCollection const & requestedTiles, bool forceUpdateUserMarks)
 {
   if (requestedTiles.empty())
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "drape_frontend/buildings_geometry_cache.hpp"
 #include "drape_frontend/engine_context.hpp"
 #include "drape_frontend/read_mwm_task.hpp"
 #include "drape_frontend/tile_info.hpp"
@@ -27,7 +28,8 @@ namespace df
 class MapDataProvider;
 class MetalineManager;
 
-uint8_t constexpr kReadingThreadsCount = 2;
+// Number of tiles reading threads. It depends on the number of available cores.
+uint8_t GetReadingThreadsCount();
 
 class ReadManager
 {
@@ -69,6 +71,9 @@ private:
 
   void PushTaskBackForTileKey(TileKey const & tileKey, ref_ptr<dp::TextureManager> texMng,
                               ref_ptr<MetalineManager> metalineMng);
+  template <typename TilesT>
+  void PushTasksByPriority(ScreenBase const & screen, TilesT const & tiles,
+                           ref_ptr<dp::TextureManager> texMng, ref_ptr<MetalineManager> metalineMng);
 
   ref_ptr<ThreadsCommutator> m_commutator;
 
@@ -104,6 +109,9 @@ private:
 
   CustomFeaturesContextPtr m_customFeaturesContext;
 
+  // Shared by all reading threads.
+  BuildingsGeometryCache m_buildingsGeometryCache;
+
   void CancelTileInfo(std::shared_ptr<TileInfo> const & tileToCancel);
   void ClearTileInfo(std::shared_ptr<TileInfo> const & tileToClear);
   void IncreaseCounter(size_t value);
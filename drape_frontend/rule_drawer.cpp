@@ -1,6 +1,7 @@
 #include "drape_frontend/rule_drawer.hpp"
 
 #include "drape_frontend/apply_feature_functors.hpp"
+#include "drape_frontend/buildings_geometry_cache.hpp"
 #include "drape_frontend/engine_context.hpp"
 #include "drape_frontend/stylist.hpp"
 #include "drape_frontend/traffic_renderer.hpp"
@@ -29,6 +30,7 @@
 
 #include <array>
 #include <functional>
+#include <iterator>
 #include <vector>
 
 namespace df
@@ -190,9 +192,19 @@ RuleDrawer::RuleDrawer(TCheckCancelledCallback const & checkCancelled,
   m_mapShapes[df::OverlayType].reserve(kAverageOverlaysCount);
 }
 
+RuleDrawer::RuleDrawer(TCheckCancelledCallback const & checkCancelled,
+                       TIsCountryLoadedByNameFn const & isLoadedFn,
+                       ref_ptr<EngineContext> engineContext, int8_t deviceLang,
+                       std::vector<FeatureID> & skippedFeatures)
+  : RuleDrawer(checkCancelled, isLoadedFn, engineContext, deviceLang)
+{
+  m_skippedFeatures = &skippedFeatures;
+  m_partChunks.emplace_back();
+}
+
 RuleDrawer::~RuleDrawer()
 {
-  if (m_wasCancelled)
+  if (m_wasCancelled || m_skippedFeatures != nullptr)
     return;
 
   for (auto const & shape : m_mapShapes[df::OverlayType])
@@ -208,6 +220,57 @@ RuleDrawer::~RuleDrawer()
   m_context->FlushTrafficGeometry(std::move(m_trafficGeometry));
 }
 
+void RuleDrawer::Merge(RuleDrawer & partDrawer, size_t chunkIndex)
+{
+  ASSERT(m_skippedFeatures == nullptr, ());
+  ASSERT(partDrawer.m_skippedFeatures != nullptr, ());
+  ASSERT_LESS(chunkIndex, partDrawer.m_partChunks.size(), ());
+
+  if (CheckCancelled())
+    return;
+
+  // The last chunk takes shapes of the features after the last skipped one.
+  if (chunkIndex + 1 == partDrawer.m_partChunks.size())
+    partDrawer.FinishPartChunk();
+
+  auto & chunk = partDrawer.m_partChunks[chunkIndex];
+  if (!chunk.m_geometryShapes.empty())
+    m_context->Flush(std::move(chunk.m_geometryShapes));
+
+  m_mapShapes[df::OverlayType].insert(m_mapShapes[df::OverlayType].end(),
+                                      std::make_move_iterator(chunk.m_overlayShapes.begin()),
+                                      std::make_move_iterator(chunk.m_overlayShapes.end()));
+  chunk.m_overlayShapes.clear();
+
+  for (auto & [mwmId, segments] : chunk.m_trafficGeometry)
+  {
+    auto & mwmSegments = m_trafficGeometry[mwmId];
+    mwmSegments.insert(mwmSegments.end(), std::make_move_iterator(segments.begin()),
+                       std::make_move_iterator(segments.end()));
+  }
+  chunk.m_trafficGeometry.clear();
+}
+
+void RuleDrawer::FinishPartChunk()
+{
+  ASSERT(m_skippedFeatures != nullptr, ());
+  ASSERT(!m_partChunks.empty(), ());
+
+  auto & chunk = m_partChunks.back();
+  auto & overlayShapes = m_mapShapes[df::OverlayType];
+  chunk.m_overlayShapes.insert(chunk.m_overlayShapes.end(), std::make_move_iterator(overlayShapes.begin()),
+                               std::make_move_iterator(overlayShapes.end()));
+  overlayShapes.clear();
+
+  for (auto & [mwmId, segments] : m_trafficGeometry)
+  {
+    auto & mwmSegments = chunk.m_trafficGeometry[mwmId];
+    mwmSegments.insert(mwmSegments.end(), std::make_move_iterator(segments.begin()),
+                       std::make_move_iterator(segments.end()));
+  }
+  m_trafficGeometry.clear();
+}
+
 bool RuleDrawer::CheckCancelled()
 {
   m_wasCancelled = m_checkCancelled();
@@ -293,17 +356,47 @@ void RuleDrawer::ProcessAreaAndPointStyle(FeatureType & f, Stylist const & s, TI
   }
 
   bool const skipTriangles = isBuildingOutline && m_context->Is3dBuildingsEnabled();
-  if (!skipTriangles && isBuilding && f.GetTrgVerticesCount(m_zoomLevel) >= 10000)
+  bool const processTriangles = !skipTriangles && (s.m_areaRule || s.m_hatchingRule);
+
+  // Building geometry doesn't depend on the tile, so it's shared between tiles.
+  // Normals of the outline are calculated for 3D buildings only.
+  auto const buildingsCache = m_context->GetBuildingsGeometryCache();
+  bool const buildingWithNormals = areaHeight > 0.0f;
+  int buildingScaleIndex = -1;
+  BuildingsGeometryCache::GeometryPtr buildingGeometry;
+  if (processTriangles && isBuilding && buildingsCache != nullptr)
+  {
+    buildingScaleIndex = f.GetTrianglesScaleIndex(m_zoomLevel);
+    buildingGeometry = buildingsCache->Find(f.GetID(), buildingScaleIndex, buildingWithNormals);
+  }
+
+  if (buildingGeometry == nullptr && !skipTriangles && isBuilding &&
+      f.GetTrgVerticesCount(m_zoomLevel) >= 10000)
+  {
     isBuilding = false;
+  }
 
   ApplyAreaFeature apply(m_context->GetTileKey(), insertShape, f,
                          m_currentScaleGtoP, isBuilding,
                          areaMinHeight /* minPosZ */, areaHeight /* posZ */,
                          s.GetCaptionDescription());
 
-  if (!skipTriangles && (s.m_areaRule || s.m_hatchingRule))
+  if (processTriangles)
   {
-    f.ForEachTriangle(apply, m_zoomLevel);
+    if (buildingGeometry != nullptr)
+    {
+      apply.SetBuildingGeometry(std::move(buildingGeometry));
+    }
+    else
+    {
+      f.ForEachTriangle(apply, m_zoomLevel);
+      if (isBuilding && buildingsCache != nullptr)
+      {
+        buildingsCache->Insert(f.GetID(), buildingScaleIndex, buildingWithNormals,
+                               apply.FinishBuildingGeometry());
+      }
+    }
+
     if (apply.HasGeometry())
       apply.ProcessAreaRules(s.m_areaRule, s.m_hatchingRule);
   }
@@ -431,6 +524,14 @@ void RuleDrawer::operator()(FeatureType & f)
   ASSERT(!hasLineAdd || hasLine, ("Pathtext/shield without a line drule", f.DebugString()));
 #endif
 
+  if (m_skippedFeatures != nullptr && (s.m_pathtextRule || s.m_shieldRule))
+  {
+    m_skippedFeatures->push_back(f.GetID());
+    FinishPartChunk();
+    m_partChunks.emplace_back();
+    return;
+  }
+
   // FeatureType::GetLimitRect call invokes full geometry reading and decoding.
   // That's why this code follows after all lightweight return options.
   m2::RectD const limitRect = f.GetLimitRect(m_zoomLevel);
@@ -475,7 +576,16 @@ void RuleDrawer::operator()(FeatureType & f)
   {
     TMapShapes geomShapes;
     geomShapes.swap(m_mapShapes[df::GeometryType]);
-    m_context->Flush(std::move(geomShapes));
+    if (m_skippedFeatures == nullptr)
+    {
+      m_context->Flush(std::move(geomShapes));
+    }
+    else
+    {
+      auto & chunkShapes = m_partChunks.back().m_geometryShapes;
+      chunkShapes.insert(chunkShapes.end(), std::make_move_iterator(geomShapes.begin()),
+                         std::make_move_iterator(geomShapes.end()));
+    }
   }
 }
 
@@ -8,6 +8,7 @@
 
 #include "drape/pointers.hpp"
 
+#include "indexer/feature_decl.hpp"
 #include "indexer/road_shields_parser.hpp"
 
 #include "geometry/rect2d.hpp"
@@ -18,6 +19,7 @@
 #include <map>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 class FeatureType;
 
@@ -33,6 +35,9 @@ class Stylist;
  * which create corresponding MapShape objects (which might in turn create OverlayHandles).
  * The RuleDrawer flushes geometry MapShapes immediately for each feature,
  * while overlay MapShapes are flushed altogether after all features are processed.
+ * Features of a dense tile can be split into parts which are processed in parallel by
+ * part RuleDrawers, the results are merged into the tile RuleDrawer in the features order
+ * (see TilePartsMerger), so the tile gets the same shapes in the same order as in serial processing.
  */
 class RuleDrawer
 {
@@ -44,10 +49,23 @@ public:
   RuleDrawer(TCheckCancelledCallback const & checkCancelled,
              TIsCountryLoadedByNameFn const & isLoadedFn,
              ref_ptr<EngineContext> engineContext, int8_t deviceLang);
+  /// Creates a part RuleDrawer. It doesn't flush shapes, they are taken by Merge().
+  /// Features with captions along lines and road shields depend on other features of the tile
+  /// (metalines and shields nearby), so they are skipped and collected into |skippedFeatures|
+  /// to be processed by the tile RuleDrawer. Shapes are split into chunks by the skipped features:
+  /// the i-th chunk holds shapes of the features which precede the i-th skipped feature.
+  RuleDrawer(TCheckCancelledCallback const & checkCancelled,
+             TIsCountryLoadedByNameFn const & isLoadedFn,
+             ref_ptr<EngineContext> engineContext, int8_t deviceLang,
+             std::vector<FeatureID> & skippedFeatures);
   ~RuleDrawer();
 
   void operator()(FeatureType & f);
 
+  /// Flushes geometry shapes and takes overlay shapes and traffic geometry of |chunkIndex|-th
+  /// chunk of finished |partDrawer|.
+  void Merge(RuleDrawer & partDrawer, size_t chunkIndex);
+
 #ifdef DRAW_TILE_NET
   void DrawTileNet();
 #endif
@@ -61,6 +79,8 @@ private:
 
   bool CheckCancelled();
 
+  void FinishPartChunk();
+
   bool IsDiscardCustomFeature(FeatureID const & id) const;
 
   TCheckCancelledCallback m_checkCancelled;
@@ -79,6 +99,16 @@ private:
 
   std::array<TMapShapes, df::MapShapeTypeCount> m_mapShapes;
 
+  // Only for part RuleDrawers.
+  struct PartChunk
+  {
+    TMapShapes m_geometryShapes;
+    TMapShapes m_overlayShapes;
+    TrafficSegmentsGeometry m_trafficGeometry;
+  };
+  std::vector<FeatureID> * m_skippedFeatures = nullptr;
+  std::vector<PartChunk> m_partChunks;
+
   GeneratedRoadShields m_generatedRoadShields;
 
   uint8_t m_zoomLevel = 0;
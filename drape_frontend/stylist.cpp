@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <utility>
 
 namespace df
 {
@@ -152,6 +153,15 @@ Stylist::Stylist(FeatureType & f, uint8_t zoomLevel, int8_t deviceLang)
 {
   feature::TypesHolder const types(f);
   Classificator const & cl = classif();
+  auto const & rulesTable = drule::rules().GetTypeRulesTable();
+
+  // Types without drules are skipped.
+  buffer_vector<std::pair<uint32_t, drule::TypeRulesTable::TypeRules const *>, feature::kMaxTypesCount> typesRules;
+  for (uint32_t t : types)
+  {
+    if (auto const * rules = rulesTable.Find(t))
+      typesRules.emplace_back(t, rules);
+  }
 
   uint32_t mainOverlayType = 0;
   if (types.Size() == 1)
@@ -161,12 +171,11 @@ Stylist::Stylist(FeatureType & f, uint8_t zoomLevel, int8_t deviceLang)
     // Determine main overlays type by priority. Priorities might be different across zoom levels
     // so a max value across all zooms is used to make sure main type doesn't change.
     int overlaysMaxPriority = std::numeric_limits<int>::min();
-    for (uint32_t t : types)
+    for (auto const & [t, rules] : typesRules)
     {
-      int const priority = cl.GetObject(t)->GetMaxOverlaysPriority();
-      if (priority > overlaysMaxPriority)
+      if (rules->m_maxOverlaysPriority > overlaysMaxPriority)
       {
-        overlaysMaxPriority = priority;
+        overlaysMaxPriority = rules->m_maxOverlaysPriority;
         mainOverlayType = t;
       }
     }
@@ -176,13 +185,11 @@ Stylist::Stylist(FeatureType & f, uint8_t zoomLevel, int8_t deviceLang)
   auto const geomType = types.GetGeomType();
 
   drule::KeysT keys;
-  for (uint32_t t : types)
+  for (auto const & [t, rules] : typesRules)
   {
-    drule::KeysT typeKeys;
-    cl.GetObject(t)->GetSuitable(zoomLevel, geomType, typeKeys);
     bool const hasHatching = hatchingChecker(t);
 
-    for (auto & k : typeKeys)
+    for (drule::Key k : rulesTable.GetKeys(*rules, zoomLevel, geomType))
     {
       // Take overlay drules from the main type only.
       if (t == mainOverlayType ||
@@ -240,8 +247,7 @@ Stylist::Stylist(FeatureType & f, uint8_t zoomLevel, int8_t deviceLang)
         }
         else
         {
-          drule::KeysT addressKeys;
-          cl.GetObject(addressType)->GetSuitable(zoomLevel, geomType, addressKeys);
+          auto const addressKeys = rulesTable.GetKeys(addressType, zoomLevel, geomType);
           if (!addressKeys.empty())
           {
             // A caption drule exists for this zoom level.
@@ -1,6 +1,7 @@
 #include "drape_frontend/threads_commutator.hpp"
 
 #include "drape_frontend/base_renderer.hpp"
+#include "drape_frontend/drape_measurer.hpp"
 
 #include "base/assert.hpp"
 
@@ -19,7 +20,13 @@ void ThreadsCommutator::PostMessage(ThreadName name, drape_ptr<Message> && messa
   TAcceptorsMap::iterator it = m_acceptors.find(name);
   ASSERT(it != m_acceptors.end(), ());
   if (it != m_acceptors.end() && it->second->CanReceiveMessages())
+  {
     it->second->PostMessage(std::move(message), priority);
+
+    auto & measurer = DrapeMeasurer::Instance();
+    if (measurer.IsTelemetryEnabled())
+      measurer.AddMessageQueueSize(name, it->second->GetQueueSize());
+  }
 }
 
 } // namespace df
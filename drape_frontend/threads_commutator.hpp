@@ -17,7 +17,9 @@ public:
   enum ThreadName
   {
     RenderThread,
-    ResourceUploadThread
+    ResourceUploadThread,
+
+    ThreadsCount
   };
 
   void RegisterThread(ThreadName name, BaseRenderer * acceptor);
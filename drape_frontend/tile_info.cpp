@@ -5,6 +5,9 @@
 #include "drape_frontend/metaline_manager.hpp"
 #include "drape_frontend/rule_drawer.hpp"
 #include "drape_frontend/stylist.hpp"
+#include "drape_frontend/tile_parts_merger.hpp"
+
+#include "drape/drape_routine.hpp"
 
 #include "indexer/scales.hpp"
 
@@ -14,12 +17,23 @@
 #include "base/logging.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
+#include <memory>
 
 using namespace std::placeholders;
 
 namespace df
 {
+namespace
+{
+// Dense tiles (buildings and roads on high zooms) are split into parts of at least this
+// features count, which are styled and converted into shapes in parallel.
+size_t constexpr kMinFeaturesCountInPart = 500;
+// The first part is processed by the reading thread, others by DrapeRoutine workers.
+size_t constexpr kMaxPartsCount = 4;
+}  // namespace
+
 TileInfo::TileInfo(drape_ptr<EngineContext> && engineContext)
   : m_context(std::move(engineContext))
   , m_isCanceled(false)
@@ -58,6 +72,7 @@ void TileInfo::ReadFeatures(MapDataProvider const & model)
 #if defined(DRAPE_MEASURER_BENCHMARK) && defined(TILES_STATISTIC)
   DrapeMeasurer::Instance().StartTileReading();
 #endif
+  auto const startTime = std::chrono::steady_clock::now();
   m_context->BeginReadTile();
 
   // Reading can be interrupted by exception throwing
@@ -74,7 +89,11 @@ void TileInfo::ReadFeatures(MapDataProvider const & model)
     auto const deviceLang = StringUtf8Multilang::GetLangIndex(languages::GetCurrentNorm());
     RuleDrawer drawer(std::bind(&TileInfo::IsCancelled, this), model.m_isCountryLoadedByName,
                       make_ref(m_context), deviceLang);
-    model.ReadFeatures(std::bind<void>(std::ref(drawer), _1), m_featureInfo);
+    size_t const partsCount = std::min(kMaxPartsCount, m_featureInfo.size() / kMinFeaturesCountInPart);
+    if (partsCount > 1)
+      ReadFeaturesInParallel(model, drawer, deviceLang, partsCount);
+    else
+      model.ReadFeatures(std::bind<void>(std::ref(drawer), _1), m_featureInfo);
 #ifdef DRAW_TILE_NET
     drawer.DrawTileNet();
 #endif
@@ -82,6 +101,82 @@ void TileInfo::ReadFeatures(MapDataProvider const & model)
 #if defined(DRAPE_MEASURER_BENCHMARK) && defined(TILES_STATISTIC)
   DrapeMeasurer::Instance().EndTileReading();
 #endif
+  DrapeMeasurer::Instance().AddTileBuildTime(std::chrono::steady_clock::now() - startTime);
+}
+
+void TileInfo::ReadFeaturesInParallel(MapDataProvider const & model, RuleDrawer & drawer,
+                                      int8_t deviceLang, size_t partsCount)
+{
+  struct Part
+  {
+    std::vector<FeatureID> m_ids;
+    std::vector<FeatureID> m_skippedFeatures;
+    std::unique_ptr<RuleDrawer> m_drawer;
+    dp::DrapeRoutine::ResultPtr m_result;
+  };
+
+  // Features are sorted, so every part reads consecutive features of one or several mwms.
+  std::vector<Part> parts(partsCount);
+  for (size_t i = 0; i < partsCount; ++i)
+  {
+    auto & part = parts[i];
+    part.m_ids.assign(m_featureInfo.begin() + i * m_featureInfo.size() / partsCount,
+                      m_featureInfo.begin() + (i + 1) * m_featureInfo.size() / partsCount);
+    part.m_drawer = std::make_unique<RuleDrawer>(std::bind(&TileInfo::IsCancelled, this),
+                                                 model.m_isCountryLoadedByName, make_ref(m_context),
+                                                 deviceLang, part.m_skippedFeatures);
+  }
+
+  auto const readPart = [&model](Part & part)
+  {
+    model.ReadFeatures(std::bind<void>(std::ref(*part.m_drawer), _1), part.m_ids);
+  };
+
+  {
+    // Parts must be finished before leaving the scope even if reading throws an exception.
+    SCOPE_GUARD(WaitParts, [&parts]()
+    {
+      for (auto & part : parts)
+      {
+        if (part.m_result)
+          part.m_result->Wait();
+      }
+    });
+
+    for (size_t i = 1; i < partsCount; ++i)
+    {
+      Part & part = parts[i];
+      part.m_result = dp::DrapeRoutine::Run([&readPart, &part]() { readPart(part); });
+      // DrapeRoutine is shut down, the part is read on the current thread.
+      if (!part.m_result)
+        readPart(part);
+    }
+    readPart(parts.front());
+  }
+
+  // Results are merged in the features order and the skipped features are processed in place,
+  // so the tile gets the same shapes in the same order as in serial reading.
+  std::vector<std::vector<FeatureID>> skippedFeatures;
+  skippedFeatures.reserve(parts.size());
+  for (auto & part : parts)
+    skippedFeatures.push_back(std::move(part.m_skippedFeatures));
+
+  TilePartsMerger merger(std::move(skippedFeatures), [&drawer, &parts](size_t partIndex, size_t chunkIndex)
+  {
+    drawer.Merge(*parts[partIndex].m_drawer, chunkIndex);
+  });
+
+  // Merge() marks the drawer as cancelled, so the cancelled tile isn't flushed.
+  auto const features = merger.GetSkippedFeatures();
+  if (!features.empty() && !IsCancelled())
+  {
+    model.ReadFeatures([&drawer, &merger](FeatureType & f)
+    {
+      merger.MergeUntil(f.GetID());
+      drawer(f);
+    }, features);
+  }
+  merger.MergeAll();
 }
 
 void TileInfo::Cancel()
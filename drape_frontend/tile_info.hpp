@@ -18,6 +18,7 @@ class FeatureType;
 namespace df
 {
 class MapDataProvider;
+class RuleDrawer;
 class Stylist;
 
 class TileInfo
@@ -37,6 +38,8 @@ public:
 
 private:
   void ReadFeatureIndex(MapDataProvider const & model);
+  void ReadFeaturesInParallel(MapDataProvider const & model, RuleDrawer & drawer, int8_t deviceLang,
+                              size_t partsCount);
   void ThrowIfCancelled() const;
   bool DoNeedReadIndex() const;
 
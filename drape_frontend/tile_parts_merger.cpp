@@ -0,0 +1,58 @@
+#include "drape_frontend/tile_parts_merger.hpp"
+
+#include "base/assert.hpp"
+
+#include <utility>
+
+namespace df
+{
+TilePartsMerger::TilePartsMerger(std::vector<std::vector<FeatureID>> && skippedFeatures,
+                                 MergeChunkFn && mergeChunk)
+  : m_skippedFeatures(std::move(skippedFeatures))
+  , m_mergeChunk(std::move(mergeChunk))
+{
+  ASSERT(m_mergeChunk != nullptr, ());
+}
+
+std::vector<FeatureID> TilePartsMerger::GetSkippedFeatures() const
+{
+  std::vector<FeatureID> features;
+  for (auto const & partFeatures : m_skippedFeatures)
+    features.insert(features.end(), partFeatures.begin(), partFeatures.end());
+  return features;
+}
+
+void TilePartsMerger::MergeUntil(FeatureID const & id)
+{
+  Merge(&id);
+}
+
+void TilePartsMerger::MergeAll()
+{
+  Merge(nullptr);
+}
+
+void TilePartsMerger::Merge(FeatureID const * id)
+{
+  while (m_partIndex < m_skippedFeatures.size())
+  {
+    auto const & partFeatures = m_skippedFeatures[m_partIndex];
+    m_mergeChunk(m_partIndex, m_chunkIndex);
+
+    if (m_chunkIndex < partFeatures.size())
+    {
+      bool const isNext = id != nullptr && partFeatures[m_chunkIndex] == *id;
+      ++m_chunkIndex;
+      if (isNext)
+        return;
+    }
+    else
+    {
+      ++m_partIndex;
+      m_chunkIndex = 0;
+    }
+  }
+
+  ASSERT(id == nullptr, ("Unknown skipped feature", *id));
+}
+}  // namespace df
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "indexer/feature_decl.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace df
+{
+/// Merges results of the parts of a tile, which are processed in parallel, in the features order.
+/// A part skips features which depend on other features of the tile, so its results are split
+/// into chunks by the skipped features: the i-th chunk precedes the i-th skipped feature and
+/// the last chunk follows the last skipped one. The skipped features are processed by the tile
+/// right after the chunks which precede them, so the tile gets the same results in the same order
+/// as in serial processing.
+class TilePartsMerger
+{
+public:
+  using MergeChunkFn = std::function<void(size_t partIndex, size_t chunkIndex)>;
+
+  /// \param skippedFeatures Skipped features of every part in the parts order.
+  TilePartsMerger(std::vector<std::vector<FeatureID>> && skippedFeatures, MergeChunkFn && mergeChunk);
+
+  /// \returns Skipped features of all parts in the features order.
+  std::vector<FeatureID> GetSkippedFeatures() const;
+
+  /// Merges the chunks which precede the skipped feature |id|, call it before processing the feature.
+  /// Skipped features which precede |id| aren't processed, e.g. if they are not read.
+  void MergeUntil(FeatureID const & id);
+  /// Merges the rest chunks, call it after processing of all skipped features.
+  void MergeAll();
+
+private:
+  void Merge(FeatureID const * id);
+
+  std::vector<std::vector<FeatureID>> m_skippedFeatures;
+  MergeChunkFn m_mergeChunk;
+  size_t m_partIndex = 0;
+  size_t m_chunkIndex = 0;
+};
+}  // namespace df
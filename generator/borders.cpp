@@ -4,13 +4,17 @@
 
 #include "platform/platform.hpp"
 
+#include "storage/country_cells_index.hpp"
 #include "storage/country_decl.hpp"
 
 #include "indexer/scales.hpp"
 
 #include "coding/files_container.hpp"
+#include "coding/geometry_coding.hpp"
+#include "coding/reader.hpp"
 #include "coding/read_write_utils.hpp"
 #include "coding/varint.hpp"
+#include "coding/writer.hpp"
 
 #include "geometry/mercator.hpp"
 #include "geometry/parametrized_segment.hpp"
@@ -81,6 +85,7 @@ public:
 
     // write polygons as paths
     WriteVarUint(w, borders.size());
+    auto & packedBorders = m_packedBorders.emplace_back();
     for (m2::RegionD const & border : borders)
     {
       std::vector<m2::PointD> const & in = border.Data();
@@ -89,7 +94,17 @@ public:
       /// @todo Choose scale level for simplification.
       SimplifyDefault(in.begin(), in.end(), base::Pow2(scales::GetEpsilonForSimplify(10)), out);
 
-      serial::SaveOuterPath(out, cp, *w);
+      std::vector<uint8_t> buffer;
+      MemWriter<std::vector<uint8_t>> memWriter(buffer);
+      serial::SaveOuterPath(out, cp, memWriter);
+      w->Write(buffer.data(), buffer.size());
+
+      // The cells index is built by borders as they are read by CountryInfoGetter.
+      MemReader memReader(buffer.data(), buffer.size());
+      ReaderSource<MemReader> src(memReader);
+      std::vector<m2::PointD> packed;
+      serial::LoadOuterPath(src, cp, packed);
+      packedBorders.emplace_back(std::move(packed));
     }
   }
 
@@ -99,10 +114,21 @@ public:
     rw::Write(*w, m_polys);
   }
 
+  void WriteCellsIndex()
+  {
+    storage::CountryCellsIndex index;
+    index.Build(m_packedBorders);
+    LOG(LINFO, ("Countries cells index nodes:", index.GetNodesCount()));
+
+    auto w = m_writer.GetWriter(PACKED_POLYGONS_CELLS_TAG);
+    index.Serialize(*w);
+  }
+
 private:
   FilesContainerW m_writer;
 
   std::vector<storage::CountryDef> m_polys;
+  storage::CountryCellsIndex::CountriesBorders m_packedBorders;
 };
 
 bool ReadPolygon(std::istream & stream, m2::RegionD & region, std::string const & filename)
@@ -211,6 +237,7 @@ void GeneratePackedBorders(std::string const & baseDir)
   PackedBordersGenerator generator(baseDir);
   ForEachCountry(baseDir, generator);
   generator.WritePolygonsInfo();
+  generator.WriteCellsIndex();
 }
 
 void DumpBorderToPolyFile(std::string const & targetDir, storage::CountryId const & mwmName,
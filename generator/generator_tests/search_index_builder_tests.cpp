@@ -0,0 +1,63 @@
+#include "testing/testing.hpp"
+
+#include "generator/generator_tests_support/test_feature.hpp"
+#include "generator/generator_tests_support/test_with_custom_mwms.hpp"
+#include "generator/search_index_builder.hpp"
+
+#include "platform/country_defines.hpp"
+#include "platform/local_country_file.hpp"
+
+#include "coding/files_container.hpp"
+#include "coding/writer.hpp"
+
+#include "geometry/point2d.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace search_index_builder_tests
+{
+using namespace generator::tests_support;
+
+using SearchIndexBuilderTest = TestWithCustomMwms;
+
+UNIT_CLASS_TEST(SearchIndexBuilderTest, ParallelBuildIsSameAsSerial)
+{
+  // Few names are reused by many features, so equal keys get into the different threads ranges.
+  std::vector<std::string> const names = {"Main Street", "Hauptstraße", "Lenina", "Cafe Central", "Market"};
+
+  auto const id = BuildCountry("Wonderland", [&](TestMwmBuilder & builder)
+  {
+    builder.Add(TestCity({0, 0}, "Wonderland City", "en", 100 /* rank */));
+    for (size_t i = 0; i < 100; ++i)
+    {
+      double const x = 0.001 * i;
+      auto const & name = names[i % names.size()];
+      builder.Add(TestStreet({{x, 0.0}, {x, 0.001}}, name + " " + std::to_string(i % 7), "default"));
+      builder.Add(TestPOI({x, 0.002}, name, "en"));
+    }
+  });
+
+  FilesContainerR container(id.GetInfo()->GetLocalFile().GetPath(MapFileType::Map));
+
+  auto const build = [&container](uint32_t threadsCount, size_t sortBufferBytes)
+  {
+    std::vector<char> buffer;
+    MemWriter<std::vector<char>> writer(buffer);
+    indexer::BuildSearchIndex(container, writer, threadsCount, sortBufferBytes);
+    return buffer;
+  };
+
+  size_t constexpr kBigBuffer = 64 * 1024 * 1024;
+  // Every thread spills tokens to the disk by few entries.
+  size_t constexpr kSmallBuffer = 1;
+
+  auto const serial = build(1 /* threadsCount */, kBigBuffer);
+  TEST(!serial.empty(), ());
+  TEST(serial == build(2 /* threadsCount */, kBigBuffer), ());
+  TEST(serial == build(7 /* threadsCount */, kBigBuffer), ());
+  TEST(serial == build(1 /* threadsCount */, kSmallBuffer), ());
+  TEST(serial == build(3 /* threadsCount */, kSmallBuffer), ());
+}
+}  // namespace search_index_builder_tests
@@ -24,6 +24,11 @@
 
 #include "platform/platform.hpp"
 
+#include "coding/file_reader.hpp"
+#include "coding/file_sort.hpp"
+#include "coding/file_writer.hpp"
+#include "coding/mmap_reader.hpp"
+#include "coding/reader.hpp"
 #include "coding/reader_writer_ops.hpp"
 #include "coding/succinct_mapper.hpp"
 #include "coding/writer.hpp"
@@ -32,6 +37,7 @@
 #include "base/checked_cast.hpp"
 #include "base/file_name_utils.hpp"
 #include "base/logging.hpp"
+#include "base/macros.hpp"
 #include "base/scope_guard.hpp"
 #include "base/stats.hpp"
 #include "base/string_utils.hpp"
@@ -42,8 +48,11 @@
 #include <algorithm>
 #include <fstream>
 #include <memory>
+#include <queue>
+#include <string>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 
@@ -127,19 +136,15 @@ class FeatureNameInserter
 {
   String2StringMap const & m_suffixes;
 
-  base::TopStatsCounter<std::string> m_stats;
+  base::TopStatsCounter<std::string> & m_stats;
 
 public:
-  explicit FeatureNameInserter(ContT & keyValuePairs)
+  FeatureNameInserter(ContT & keyValuePairs, base::TopStatsCounter<std::string> & stats)
     : m_suffixes(GetDACHStreets())
+    , m_stats(stats)
     , m_keyValuePairs(keyValuePairs)
   {
   }
-  ~FeatureNameInserter()
-  {
-    LOG(LINFO, ("Top street's name tokens:"));
-    m_stats.PrintTop(10);
-  }
 
   void SetFeature(uint32_t index, SynonymsHolder const * synonyms, bool hasStreetType)
   {
@@ -286,12 +291,12 @@ template <class ContT>
 class FeatureInserter
 {
 public:
-  FeatureInserter(SynonymsHolder * synonyms, ContT & keyValuePairs,
+  FeatureInserter(SynonymsHolder * synonyms, ContT & keyValuePairs, base::TopStatsCounter<std::string> & stats,
                   CategoriesHolder const & catHolder, std::pair<int, int> const & scales)
     : m_synonyms(synonyms)
     , m_categories(catHolder)
     , m_scales(scales)
-    , m_inserter(keyValuePairs)
+    , m_inserter(keyValuePairs, stats)
   {
   }
 
@@ -381,17 +386,152 @@ private:
 };
 
 template <class ContT>
-void AddFeatureNameIndexPairs(FeaturesVectorTest const & features,
-                              CategoriesHolder const & categoriesHolder,
-                              ContT & keyValuePairs)
+void AddFeatureNameIndexPairs(FeaturesVectorTest const & features, SynonymsHolder * synonyms,
+                              CategoriesHolder const & categoriesHolder, uint32_t beg, uint32_t end,
+                              ContT & keyValuePairs, base::TopStatsCounter<std::string> & stats)
 {
-  feature::DataHeader const & header = features.GetHeader();
+  FeatureInserter inserter(synonyms, keyValuePairs, stats, categoriesHolder, features.GetHeader().GetScaleRange());
+  for (uint32_t i = beg; i < end; ++i)
+  {
+    auto ft = features.GetVector().GetByIndex(i);
+    // Feature's index is used for metadata loading, see FeaturesVector::ForEach.
+    ft->SetID(FeatureID(MwmSet::MwmId(), i));
+    inserter(*ft, i);
+  }
+}
 
-  std::unique_ptr<SynonymsHolder> synonyms;
-  if (header.GetType() == feature::DataHeader::MapType::World)
-    synonyms = std::make_unique<SynonymsHolder>();
+using Key = strings::UniString;
+using Value = Uint64IndexValue;
+
+// Sorted (key, value) pairs of a features range. Every key is stored once in the run's dictionary,
+// so pairs are sorted as fixed size entries by FileSorter which spills them to the disk.
+class SortedRun
+{
+public:
+  struct Entry
+  {
+    uint32_t m_keyId = 0;
+    Value m_value;
+  };
+
+  SortedRun(std::string const & fileName, size_t bufferBytes)
+    : m_fileName(fileName + ".run" EXTENSION_TMP)
+    , m_writer(std::make_unique<FileWriter>(m_fileName))
+    , m_sink{*m_writer}
+    , m_sorter(std::make_unique<Sorter>(bufferBytes, fileName + ".chunks" EXTENSION_TMP, m_sink, EntryLess{m_keys}))
+  {
+  }
+
+  ~SortedRun()
+  {
+    m_sorter.reset();
+    m_writer.reset();
+    FileWriter::DeleteFileX(m_fileName);
+  }
+
+  // Called by FeatureNameInserter.
+  void emplace_back(Key const & key, uint32_t value)
+  {
+    auto const it = m_keyIds.emplace(key, static_cast<uint32_t>(m_keys.size())).first;
+    if (it->second == m_keys.size())
+      m_keys.push_back(&it->first);
+    m_sorter->Add({it->second, Value(value)});
+  }
+
+  // Writes all the entries to the run file in sorted order.
+  void Finish()
+  {
+    m_sorter->SortAndFinish();
+    m_sorter.reset();
+    m_writer.reset();
+  }
+
+  std::string const & GetFileName() const { return m_fileName; }
+  Key const & GetKey(Entry const & e) const { return *m_keys[e.m_keyId]; }
+
+private:
+  struct KeyHash
+  {
+    size_t operator()(Key const & key) const
+    {
+      size_t h = 0;
+      for (auto const c : key)
+        h = h * 31 + c;
+      return h;
+    }
+  };
+
+  struct EntryLess
+  {
+    bool operator()(Entry const & lhs, Entry const & rhs) const
+    {
+      if (lhs.m_keyId != rhs.m_keyId)
+        return *m_keys[lhs.m_keyId] < *m_keys[rhs.m_keyId];
+      return lhs.m_value < rhs.m_value;
+    }
+
+    std::vector<Key const *> const & m_keys;
+  };
+
+  struct Sink
+  {
+    void operator()(Entry const & e) const { m_writer.Write(&e, sizeof(e)); }
+
+    FileWriter & m_writer;
+  };
+
+  using Sorter = FileSorter<Entry, Sink, EntryLess>;
+
+  std::string const m_fileName;
+  // Keys of the map are not moved on rehash, so |m_keys| points to them.
+  std::unordered_map<Key, uint32_t, KeyHash> m_keyIds;
+  std::vector<Key const *> m_keys;
+  std::unique_ptr<FileWriter> m_writer;
+  Sink m_sink;
+  std::unique_ptr<Sorter> m_sorter;
 
-  features.GetVector().ForEach(FeatureInserter(synonyms.get(), keyValuePairs, categoriesHolder, header.GetScaleRange()));
+  DISALLOW_COPY_AND_MOVE(SortedRun);
+};
+
+// Merges finished |runs| and passes (key, value) pairs to |fn| in sorted order.
+template <class Fn>
+void MergeSortedRuns(std::vector<std::unique_ptr<SortedRun>> const & runs, Fn && fn)
+{
+  std::vector<ReaderSource<FileReader>> sources;
+  sources.reserve(runs.size());
+  for (auto const & run : runs)
+    sources.emplace_back(FileReader(run->GetFileName()));
+
+  // Current entry of every run.
+  std::vector<SortedRun::Entry> entries(runs.size());
+  auto const greater = [&runs, &entries](size_t lhs, size_t rhs)
+  {
+    auto const & lKey = runs[lhs]->GetKey(entries[lhs]);
+    auto const & rKey = runs[rhs]->GetKey(entries[rhs]);
+    if (lKey != rKey)
+      return rKey < lKey;
+    return entries[rhs].m_value < entries[lhs].m_value;
+  };
+
+  std::priority_queue<size_t, std::vector<size_t>, decltype(greater)> queue(greater);
+  auto const next = [&](size_t run)
+  {
+    if (sources[run].Size() == 0)
+      return;
+    sources[run].Read(&entries[run], sizeof(SortedRun::Entry));
+    queue.push(run);
+  };
+
+  for (size_t i = 0; i < runs.size(); ++i)
+    next(i);
+
+  while (!queue.empty())
+  {
+    auto const run = queue.top();
+    queue.pop();
+    fn(std::make_pair(runs[run]->GetKey(entries[run]), entries[run].m_value));
+    next(run);
+  }
 }
 
 void ReadAddressData(std::string const & filename, std::vector<feature::AddressData> & addrs)
@@ -590,8 +730,6 @@ void BuildAddressTable(FilesContainerR & container, std::string const & addressD
 }  // namespace
 
 
-void BuildSearchIndex(FilesContainerR & container, Writer & indexWriter);
-
 bool BuildSearchIndexFromDataFile(std::string const & country, feature::GenerateInfo const & info,
                                   bool forceRebuild, uint32_t threadsCount)
 {
@@ -613,7 +751,7 @@ bool BuildSearchIndexFromDataFile(std::string const & country, feature::Generate
   {
     {
       FileWriter writer(indexFilePath);
-      BuildSearchIndex(readContainer, writer);
+      BuildSearchIndex(readContainer, writer, threadsCount);
       LOG(LINFO, ("Search index size =", writer.Size()));
     }
 
@@ -674,27 +812,62 @@ bool BuildSearchIndexFromDataFile(std::string const & country, feature::Generate
   return true;
 }
 
-void BuildSearchIndex(FilesContainerR & container, Writer & indexWriter)
+void BuildSearchIndex(FilesContainerR & container, Writer & indexWriter, uint32_t threadsCount,
+                      size_t sortBufferBytes)
 {
-  using Key = strings::UniString;
-  using Value = Uint64IndexValue;
-
   LOG(LINFO, ("Start building search index for", container.GetFileName()));
   base::Timer timer;
 
   auto const & categoriesHolder = GetDefaultCategories();
 
-  FeaturesVectorTest features(container);
-  SingleValueSerializer<Value> serializer;
+  // Features are read only, so one vector is shared by all the threads. It works over the memory
+  // mapped file because FileReader's page cache is not thread-safe.
+  FeaturesVectorTest const features((FilesContainerR(std::make_unique<MmapReader>(container.GetFileName()))));
+  auto const featuresCount = static_cast<uint32_t>(features.GetVector().GetNumFeatures());
+
+  std::unique_ptr<SynonymsHolder> synonyms;
+  if (features.GetHeader().GetType() == feature::DataHeader::MapType::World)
+    synonyms = std::make_unique<SynonymsHolder>();
 
-  std::vector<std::pair<Key, Value>> searchIndexKeyValuePairs;
-  AddFeatureNameIndexPairs(features, categoriesHolder, searchIndexKeyValuePairs);
+  threadsCount = std::max(threadsCount, 1U);
+
+  // Tokens of every features range are extracted and sorted in a separate thread, sorted runs are
+  // spilled to the disk. Then the runs are merged and streamed into the trie builder.
+  std::vector<std::unique_ptr<SortedRun>> runs;
+  for (uint32_t i = 0; i < threadsCount; ++i)
+  {
+    auto const fileName = container.GetFileName() + "." SEARCH_INDEX_FILE_TAG "." + strings::to_string(i);
+    runs.push_back(std::make_unique<SortedRun>(fileName, sortBufferBytes / threadsCount));
+  }
+
+  std::vector<base::TopStatsCounter<std::string>> stats(threadsCount);
+  auto const fn = [&](uint32_t threadIdx)
+  {
+    auto const beg = static_cast<uint32_t>(uint64_t(featuresCount) * threadIdx / threadsCount);
+    auto const end = static_cast<uint32_t>(uint64_t(featuresCount) * (threadIdx + 1) / threadsCount);
+    AddFeatureNameIndexPairs(features, synonyms.get(), categoriesHolder, beg, end, *runs[threadIdx],
+                             stats[threadIdx]);
+    runs[threadIdx]->Finish();
+  };
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 1; i < threadsCount; ++i)
+    threads.emplace_back(fn, i);
+  fn(0);
+  for (auto & t : threads)
+    t.join();
+
+  for (uint32_t i = 1; i < threadsCount; ++i)
+    stats[0].Merge(stats[i]);
+  LOG(LINFO, ("Top street's name tokens:"));
+  stats[0].PrintTop(10);
 
-  std::sort(searchIndexKeyValuePairs.begin(), searchIndexKeyValuePairs.end());
   LOG(LINFO, ("End sorting strings:", timer.ElapsedSeconds()));
 
-  trie::Build<Writer, Key, ValueList<Value>, SingleValueSerializer<Value>>(
-      indexWriter, serializer, searchIndexKeyValuePairs);
+  SingleValueSerializer<Value> serializer;
+  trie::Builder<Writer, Key, ValueList<Value>, SingleValueSerializer<Value>> builder(indexWriter, serializer);
+  MergeSortedRuns(runs, [&builder](auto const & e) { builder.Add(e); });
+  builder.Finish();
 
   LOG(LINFO, ("End building search index, elapsed seconds:", timer.ElapsedSeconds()));
 }
@@ -4,6 +4,11 @@
 
 #include "indexer/ftypes_matcher.hpp"
 
+#include "coding/files_container.hpp"
+#include "coding/writer.hpp"
+
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -44,4 +49,10 @@ private:
 // in version mismatch when trying to read the index.
 bool BuildSearchIndexFromDataFile(std::string const & country, feature::GenerateInfo const & info,
                                   bool forceRebuild, uint32_t threadsCount);
+
+// Writes the search index trie of the |container| mwm into |indexWriter|. Features are split
+// into |threadsCount| ranges processed in parallel; the result doesn't depend on |threadsCount|.
+// Tokens which don't fit into |sortBufferBytes| are sorted on the disk next to the mwm.
+void BuildSearchIndex(FilesContainerR & container, Writer & indexWriter, uint32_t threadsCount,
+                      size_t sortBufferBytes = 256 * 1024 * 1024);
 }  // namespace indexer
@@ -266,6 +266,9 @@ public:
 
   void Clear() { m_tree.clear(); }
 
+  // Rebalances the tree, it's useful after adding many objects one by one.
+  void Optimize() { m_tree.optimise(); }
+
   std::string DebugPrint() const
   {
     std::ostringstream out;
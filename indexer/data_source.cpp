@@ -1,11 +1,16 @@
 #include "indexer/data_source.hpp"
+#include "indexer/mwm_registry_cache.hpp"
 #include "indexer/scale_index.hpp"
 #include "indexer/unique_index.hpp"
 
 #include "platform/mwm_version.hpp"
+#include "platform/platform.hpp"
 
 #include <algorithm>
+#include <ctime>
 #include <limits>
+#include <optional>
+#include <string>
 
 using platform::CountryFile;
 using platform::LocalCountryFile;
@@ -150,26 +155,55 @@ std::unique_ptr<FeatureType> FeaturesLoaderGuard::GetOriginalFeatureByIndex(uint
 // DataSource ----------------------------------------------------------------------------------
 std::unique_ptr<MwmInfo> DataSource::CreateInfo(platform::LocalCountryFile const & localFile) const
 {
-  MwmValue value(localFile);
+  std::optional<MwmRegistryCache::Entry> entry;
 
-  feature::DataHeader const & h = value.GetHeader();
+  std::string path;
+  uint64_t fileSize = 0;
+  time_t modificationTime = 0;
+  bool const useCache = m_registryCache && localFile.OnDisk(MapFileType::Map);
+  if (useCache)
+  {
+    path = localFile.GetPath(MapFileType::Map);
+    if (Platform::GetFileSizeByFullPath(path, fileSize))
+    {
+      modificationTime = Platform::GetFileModificationTime(path);
+      entry = m_registryCache->Find(path, fileSize, modificationTime);
+    }
+  }
 
-  auto info = std::make_unique<MwmInfoEx>();
-  info->m_bordersRect = h.GetBounds();
+  if (!entry)
+  {
+    MwmValue value(localFile);
 
-  auto const scaleR = h.GetScaleRange();
-  info->m_minScale = static_cast<uint8_t>(scaleR.first);
-  info->m_maxScale = static_cast<uint8_t>(scaleR.second);
-  info->m_version = value.GetMwmVersion();
-  value.m_factory.MoveRegionData(info->m_data);
+    feature::DataHeader const & h = value.GetHeader();
+
+    entry.emplace();
+    entry->m_bordersRect = h.GetBounds();
+
+    auto const scaleR = h.GetScaleRange();
+    entry->m_minScale = static_cast<uint8_t>(scaleR.first);
+    entry->m_maxScale = static_cast<uint8_t>(scaleR.second);
+    entry->m_version = value.GetMwmVersion();
+    value.m_factory.MoveRegionData(entry->m_data);
+
+    if (useCache && fileSize != 0)
+      m_registryCache->Add(path, fileSize, modificationTime, *entry);
+  }
+
+  auto info = std::make_unique<MwmInfoEx>();
+  info->m_bordersRect = entry->m_bordersRect;
+  info->m_minScale = entry->m_minScale;
+  info->m_maxScale = entry->m_maxScale;
+  info->m_version = entry->m_version;
+  info->m_data = std::move(entry->m_data);
 
   return info;
 }
 
-std::unique_ptr<MwmValue> DataSource::CreateValue(MwmInfo & info) const
+std::unique_ptr<MwmValue> DataSource::CreateValue(MwmInfo & info,
+                                                  platform::LocalCountryFile const & localFile) const
 {
-  platform::LocalCountryFile const & localFile = info.GetLocalFile();
-  auto p = std::make_unique<MwmValue>(localFile);
+  auto p = std::make_unique<MwmValue>(localFile, m_readMode);
 
   p->SetTable(dynamic_cast<MwmInfoEx &>(info));
 
@@ -9,6 +9,8 @@
 #include <utility>
 #include <vector>
 
+class MwmRegistryCache;
+
 class DataSource : public MwmSet
 {
 public:
@@ -51,11 +53,20 @@ public:
     return (*m_factory)(handle);
   }
 
+  /// Mwms which are found in |cache| are registered without reading, properties of read mwms are
+  /// added to |cache|. Should be set before the registration of mwms.
+  void SetRegistryCache(std::shared_ptr<MwmRegistryCache> cache) { m_registryCache = std::move(cache); }
+
 protected:
   using ReaderCallback = std::function<void(MwmSet::MwmHandle const & handle,
                                             covering::CoveringGetter & cov, int scale)>;
 
-  explicit DataSource(std::unique_ptr<FeatureSourceFactory> factory) : m_factory(std::move(factory)) {}
+  /// \param readMode Defines how values of registered mwms read their sections, see MwmValue::ReadMode.
+  explicit DataSource(std::unique_ptr<FeatureSourceFactory> factory,
+                      MwmValue::ReadMode readMode = MwmValue::ReadMode::Cached)
+    : m_factory(std::move(factory)), m_readMode(readMode)
+  {
+  }
 
   void ForEachInIntervals(ReaderCallback const & fn, covering::CoveringMode mode,
                           m2::RectD const & rect, int scale) const;
@@ -63,11 +74,14 @@ protected:
   /// @name MwmSet overrides
   /// @{
   std::unique_ptr<MwmInfo> CreateInfo(platform::LocalCountryFile const & localFile) const override;
-  std::unique_ptr<MwmValue> CreateValue(MwmInfo & info) const override;
+  std::unique_ptr<MwmValue> CreateValue(MwmInfo & info,
+                                        platform::LocalCountryFile const & localFile) const override;
   /// @}
 
 private:
   std::unique_ptr<FeatureSourceFactory> m_factory;
+  MwmValue::ReadMode const m_readMode;
+  std::shared_ptr<MwmRegistryCache> m_registryCache;
 };
 
 // DataSource which operates with features from mwm file and does not support features creation
@@ -75,7 +89,10 @@ private:
 class FrozenDataSource : public DataSource
 {
 public:
-  FrozenDataSource() : DataSource(std::make_unique<FeatureSourceFactory>()) {}
+  explicit FrozenDataSource(MwmValue::ReadMode readMode = MwmValue::ReadMode::Cached)
+    : DataSource(std::make_unique<FeatureSourceFactory>(), readMode)
+  {
+  }
 };
 
 /// Guard for loading features from particular MWM by demand.
@@ -83,6 +83,7 @@ void RulesHolder::Clean()
 
   m_dRules.clear();
   m_colors.clear();
+  m_typeRulesTable.Clear();
 }
 
 Key RulesHolder::AddRule(int scale, TypeT type, BaseRule * p)
@@ -418,6 +419,7 @@ void RulesHolder::LoadFromBinaryProto(string const & s)
   CHECK ( doSet.m_cont.ParseFromString(s), ("Error in proto loading!") );
 
   classif().GetMutableRoot()->ForEachObject(ref(doSet));
+  m_typeRulesTable.Build(classif());
 
   InitBackgroundColors(doSet.m_cont);
   InitColors(doSet.m_cont);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "indexer/drawing_rule_def.hpp"
+#include "indexer/drawing_rules_table.hpp"
 #include "indexer/drules_selector.hpp"
 #include "indexer/map_style.hpp"
 
@@ -62,6 +63,9 @@ namespace drule
 
     BaseRule const * Find(Key const & k) const;
 
+    /// Drules of classificator types precomputed for all zoom levels on loading.
+    TypeRulesTable const & GetTypeRulesTable() const { return m_typeRulesTable; }
+
     uint32_t GetBgColor(int scale) const;
     uint32_t GetColor(std::string const & name) const;
 
@@ -87,6 +91,7 @@ namespace drule
     std::vector<uint32_t> m_bgColors;
     std::unordered_map<std::string, uint32_t> m_colors;
     std::vector<BaseRule *> m_dRules;
+    TypeRulesTable m_typeRulesTable;
   };
 
   RulesHolder & rules();
@@ -0,0 +1,75 @@
+#include "indexer/drawing_rules_table.hpp"
+
+#include "indexer/classificator.hpp"
+
+#include "base/assert.hpp"
+
+namespace drule
+{
+void TypeRulesTable::Build(Classificator const & c)
+{
+  Clear();
+
+  c.ForEachTree([this, &c](ClassifObject const * p, uint32_t type)
+  {
+    if (!p->IsDrawableAny())
+      return;
+
+    TypeRules rules;
+    rules.m_maxOverlaysPriority = p->GetMaxOverlaysPriority();
+    rules.m_begin = static_cast<uint32_t>(m_keys.size());
+
+    KeysT keys;
+    for (int zoom = 0; zoom <= scales::UPPER_STYLE_SCALE; ++zoom)
+    {
+      for (int geomType = 0; geomType < TypeRules::kGeomTypesCount; ++geomType)
+      {
+        size_t const index = zoom * TypeRules::kGeomTypesCount + geomType;
+        rules.m_offsets[index] = static_cast<uint16_t>(m_keys.size() - rules.m_begin);
+
+        keys.clear();
+        p->GetSuitable(zoom, static_cast<feature::GeomType>(geomType), keys);
+        m_keys.insert(m_keys.end(), keys.begin(), keys.end());
+      }
+    }
+
+    size_t const count = m_keys.size() - rules.m_begin;
+    CHECK_LESS_OR_EQUAL(count, std::numeric_limits<uint16_t>::max(), (c.GetFullObjectName(type)));
+    rules.m_offsets.back() = static_cast<uint16_t>(count);
+
+    m_types.emplace(type, rules);
+  });
+}
+
+void TypeRulesTable::Clear()
+{
+  m_types.clear();
+  m_keys.clear();
+}
+
+TypeRulesTable::TypeRules const * TypeRulesTable::Find(uint32_t type) const
+{
+  auto const it = m_types.find(type);
+  return it != m_types.end() ? &it->second : nullptr;
+}
+
+std::span<Key const> TypeRulesTable::GetKeys(TypeRules const & rules, int zoomLevel,
+                                             feature::GeomType geomType) const
+{
+  ASSERT(zoomLevel >= 0 && zoomLevel <= scales::UPPER_STYLE_SCALE, (zoomLevel));
+  ASSERT(static_cast<int>(geomType) >= 0 && static_cast<int>(geomType) < TypeRules::kGeomTypesCount,
+         (geomType));
+
+  size_t const index = zoomLevel * TypeRules::kGeomTypesCount + static_cast<int>(geomType);
+  Key const * begin = m_keys.data() + rules.m_begin;
+  return {begin + rules.m_offsets[index], begin + rules.m_offsets[index + 1]};
+}
+
+std::span<Key const> TypeRulesTable::GetKeys(uint32_t type, int zoomLevel, feature::GeomType geomType) const
+{
+  auto const * rules = Find(type);
+  if (rules == nullptr)
+    return {};
+  return GetKeys(*rules, zoomLevel, geomType);
+}
+}  // namespace drule
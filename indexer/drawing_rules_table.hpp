@@ -0,0 +1,55 @@
+#pragma once
+
+#include "indexer/drawing_rule_def.hpp"
+#include "indexer/feature_decl.hpp"
+#include "indexer/scales.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+class Classificator;
+
+namespace drule
+{
+/// Drawing rules keys of classificator types resolved for every zoom level and geometry type.
+/// It's built once on the style loading, so features styling doesn't traverse the classificator
+/// tree and doesn't search drules by scale for every feature type.
+class TypeRulesTable
+{
+public:
+  struct TypeRules
+  {
+    int m_maxOverlaysPriority = std::numeric_limits<int>::min();
+
+  private:
+    friend class TypeRulesTable;
+
+    static int constexpr kGeomTypesCount = 3;
+    static int constexpr kRangesCount = (scales::UPPER_STYLE_SCALE + 1) * kGeomTypesCount;
+
+    // Keys for the zoom level and the geometry type are in
+    // [m_begin + m_offsets[i], m_begin + m_offsets[i + 1]), i = zoomLevel * kGeomTypesCount + geomType.
+    uint32_t m_begin = 0;
+    std::array<uint16_t, kRangesCount + 1> m_offsets = {};
+  };
+
+  /// Builds the table from drules of the classificator objects (see ClassifObject::GetSuitable).
+  void Build(Classificator const & c);
+  void Clear();
+
+  /// \returns nullptr if |type| has no drawing rules.
+  TypeRules const * Find(uint32_t type) const;
+
+  /// \returns The same keys as ClassifObject::GetSuitable(zoomLevel, geomType).
+  std::span<Key const> GetKeys(TypeRules const & rules, int zoomLevel, feature::GeomType geomType) const;
+  std::span<Key const> GetKeys(uint32_t type, int zoomLevel, feature::GeomType geomType) const;
+
+private:
+  std::unordered_map<uint32_t, TypeRules> m_types;
+  std::vector<Key> m_keys;
+};
+}  // namespace drule
@@ -570,6 +570,18 @@ void FeatureType::ParseTriangles(int scale)
   }
 }
 
+int FeatureType::GetTrianglesScaleIndex(int scale)
+{
+  // Features created from MapObjects have the only geometry.
+  if (!m_loadInfo)
+    return -1;
+
+  ParseHeader2();
+  if (m_offsets.m_trg.empty())
+    return -1;
+  return GetScaleIndex(*m_loadInfo, scale, m_offsets.m_trg);
+}
+
 FeatureType::GeomStat FeatureType::GetOuterTrianglesStats()
 {
   CHECK(m_loadInfo && m_parsed.m_header2 && !m_parsed.m_triangles, ("Call geometry stats first and once!"));
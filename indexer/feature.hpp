@@ -116,6 +116,10 @@ public:
   }
 
   size_t GetPointsCount() const;
+  /// \returns Index of the triangles geometry level which is read for |scale|
+  /// or -1 if triangles don't depend on the scale (they are stored in the feature itself).
+  int GetTrianglesScaleIndex(int scale);
+
   size_t GetTrgVerticesCount(int scale)
   {
     ParseTriangles(scale);
@@ -0,0 +1,186 @@
+#include "indexer/feature_attributes_cache.hpp"
+
+#include "indexer/data_source.hpp"
+#include "indexer/feature.hpp"
+#include "indexer/feature_algo.hpp"
+
+#include "base/assert.hpp"
+
+#include <sstream>
+
+FeatureAttributesCache::FeatureAttributesCache(size_t maxSize,
+                                               std::vector<feature::Metadata::EType> const & metadataTypes)
+  : m_maxShardSize((maxSize + kShardsCount - 1) / kShardsCount), m_metadataTypes(metadataTypes)
+{
+  CHECK_GREATER(maxSize, 0, ());
+}
+
+FeatureAttributesCache::AttributesPtr FeatureAttributesCache::Get(FeatureType & ft)
+{
+  FeatureID const & id = ft.GetID();
+  if (auto attrs = Find(id))
+    return attrs;
+
+  // Feature is decoded without the lock, it's the most expensive part.
+  auto attrs = Decode(ft);
+
+  Shard & shard = GetShard(id);
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  return InsertImpl(shard, id, std::move(attrs));
+}
+
+FeatureAttributesCache::AttributesPtr FeatureAttributesCache::Get(DataSource const & dataSource,
+                                                                  FeatureID const & id)
+{
+  {
+    Shard & shard = GetShard(id);
+    std::lock_guard<std::mutex> lock(shard.m_mutex);
+    // A miss is counted by Get(FeatureType &) below.
+    if (auto attrs = FindImpl(shard, id))
+    {
+      ++m_hits;
+      return attrs;
+    }
+  }
+
+  AttributesPtr attrs;
+  dataSource.ReadFeature([&](FeatureType & ft) { attrs = Get(ft); }, id);
+  return attrs;
+}
+
+FeatureAttributesCache::AttributesPtr FeatureAttributesCache::Find(FeatureID const & id)
+{
+  Shard & shard = GetShard(id);
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  auto attrs = FindImpl(shard, id);
+  if (attrs)
+    ++m_hits;
+  else
+    ++m_misses;
+  return attrs;
+}
+
+void FeatureAttributesCache::Invalidate(FeatureID const & id)
+{
+  Shard & shard = GetShard(id);
+  std::lock_guard<std::mutex> lock(shard.m_mutex);
+  auto const it = shard.m_index.find(id);
+  if (it == shard.m_index.end())
+    return;
+
+  shard.m_entries.erase(it->second);
+  shard.m_index.erase(it);
+}
+
+void FeatureAttributesCache::Clear()
+{
+  for (auto & shard : m_shards)
+  {
+    std::lock_guard<std::mutex> lock(shard.m_mutex);
+    shard.m_entries.clear();
+    shard.m_index.clear();
+  }
+}
+
+FeatureAttributesCache::Stats FeatureAttributesCache::GetStats() const
+{
+  Stats stats;
+  stats.m_hits = m_hits;
+  stats.m_misses = m_misses;
+  stats.m_evictions = m_evictions;
+  return stats;
+}
+
+size_t FeatureAttributesCache::GetSize() const
+{
+  size_t size = 0;
+  for (auto & shard : m_shards)
+  {
+    std::lock_guard<std::mutex> lock(shard.m_mutex);
+    size += shard.m_index.size();
+  }
+  return size;
+}
+
+void FeatureAttributesCache::OnMapDeregistered(platform::LocalCountryFile const & localFile)
+{
+  for (auto & shard : m_shards)
+  {
+    std::lock_guard<std::mutex> lock(shard.m_mutex);
+    for (auto it = shard.m_entries.begin(); it != shard.m_entries.end();)
+    {
+      if (it->first.m_mwmId.IsDeregistered(localFile))
+      {
+        shard.m_index.erase(it->first);
+        it = shard.m_entries.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+}
+
+FeatureAttributesCache::Shard & FeatureAttributesCache::GetShard(FeatureID const & id)
+{
+  return m_shards[std::hash<FeatureID>()(id) % kShardsCount];
+}
+
+FeatureAttributesCache::AttributesPtr FeatureAttributesCache::FindImpl(Shard & shard,
+                                                                       FeatureID const & id)
+{
+  auto const it = shard.m_index.find(id);
+  if (it == shard.m_index.end())
+    return nullptr;
+
+  shard.m_entries.splice(shard.m_entries.begin(), shard.m_entries, it->second);
+  return it->second->second;
+}
+
+FeatureAttributesCache::AttributesPtr FeatureAttributesCache::InsertImpl(Shard & shard,
+                                                                         FeatureID const & id,
+                                                                         AttributesPtr attrs)
+{
+  // The same feature may be decoded concurrently by several threads.
+  auto const it = shard.m_index.find(id);
+  if (it != shard.m_index.end())
+    return it->second->second;
+
+  shard.m_entries.emplace_front(id, attrs);
+  shard.m_index.emplace(id, shard.m_entries.begin());
+
+  if (shard.m_entries.size() > m_maxShardSize)
+  {
+    shard.m_index.erase(shard.m_entries.back().first);
+    shard.m_entries.pop_back();
+    ++m_evictions;
+  }
+  return attrs;
+}
+
+FeatureAttributesCache::AttributesPtr FeatureAttributesCache::Decode(FeatureType & ft) const
+{
+  auto attrs = std::make_shared<FeatureAttributes>();
+  attrs->m_types = feature::TypesHolder(ft);
+  attrs->m_names = ft.GetNames();
+  attrs->m_center = feature::GetCenter(ft);
+  attrs->m_rank = ft.GetRank();
+  attrs->m_houseNumber = ft.GetHouseNumber();
+
+  for (auto const type : m_metadataTypes)
+  {
+    auto const value = ft.GetMetadata(type);
+    if (!value.empty())
+      attrs->m_metadata.Set(type, std::string(value));
+  }
+  return attrs;
+}
+
+std::string DebugPrint(FeatureAttributesCache::Stats const & stats)
+{
+  std::ostringstream os;
+  os << "FeatureAttributesCache::Stats [ hits: " << stats.m_hits << ", misses: " << stats.m_misses
+     << ", evictions: " << stats.m_evictions << " ]";
+  return os.str();
+}
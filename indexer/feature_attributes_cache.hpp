@@ -0,0 +1,111 @@
+#pragma once
+
+#include "indexer/feature_data.hpp"
+#include "indexer/feature_decl.hpp"
+#include "indexer/feature_meta.hpp"
+#include "indexer/mwm_set.hpp"
+
+#include "coding/string_utf8_multilang.hpp"
+
+#include "geometry/point2d.hpp"
+
+#include "base/macros.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class DataSource;
+class FeatureType;
+
+/// Decoded feature attributes which are requested again and again for the same (popular) features.
+/// Only attributes which don't need the feature geometry are kept. So far names of regions (cities)
+/// for bookmarks are read through the cache (see ReverseGeocoder::GetLocalizedRegionAddress).
+struct FeatureAttributes
+{
+  feature::TypesHolder m_types;
+  StringUtf8Multilang m_names;
+  m2::PointD m_center;
+  uint8_t m_rank = 0;
+  std::string m_houseNumber;
+  /// Only metadata types passed to FeatureAttributesCache constructor are stored.
+  feature::Metadata m_metadata;
+};
+
+/// Thread-safe size-bounded (LRU) cache of decoded feature attributes keyed by FeatureID.
+/// Entries are invalidated on mwm deregistration (the cache should be added as an observer
+/// to the corresponding MwmSet) and explicitly on feature edits.
+class FeatureAttributesCache : public MwmSet::Observer
+{
+public:
+  using AttributesPtr = std::shared_ptr<FeatureAttributes const>;
+
+  struct Stats
+  {
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+    uint64_t m_evictions = 0;
+  };
+
+  /// \param maxSize Maximum number of cached features. It should be one or greater.
+  /// \param metadataTypes Metadata which is copied to FeatureAttributes::m_metadata.
+  explicit FeatureAttributesCache(size_t maxSize,
+                                  std::vector<feature::Metadata::EType> const & metadataTypes = {});
+
+  /// \returns Cached attributes of |ft| or decodes, caches and returns them.
+  AttributesPtr Get(FeatureType & ft);
+
+  /// \returns Cached attributes of |id| or reads the feature from |dataSource|, decodes,
+  /// caches and returns them. Returns nullptr if the feature can't be read.
+  AttributesPtr Get(DataSource const & dataSource, FeatureID const & id);
+
+  /// \returns Cached attributes or nullptr if there are no attributes for |id| in the cache.
+  AttributesPtr Find(FeatureID const & id);
+
+  /// Should be called when the feature is edited.
+  void Invalidate(FeatureID const & id);
+  void Clear();
+
+  Stats GetStats() const;
+  size_t GetSize() const;
+
+  // MwmSet::Observer overrides:
+  void OnMapDeregistered(platform::LocalCountryFile const & localFile) override;
+
+private:
+  using Entries = std::list<std::pair<FeatureID, AttributesPtr>>;
+
+  struct Shard
+  {
+    std::mutex m_mutex;
+    // Most recently used entries are at the front.
+    Entries m_entries;
+    std::unordered_map<FeatureID, Entries::iterator> m_index;
+  };
+
+  static size_t constexpr kShardsCount = 16;
+
+  Shard & GetShard(FeatureID const & id);
+  AttributesPtr FindImpl(Shard & shard, FeatureID const & id);
+  AttributesPtr InsertImpl(Shard & shard, FeatureID const & id, AttributesPtr attrs);
+  AttributesPtr Decode(FeatureType & ft) const;
+
+  size_t const m_maxShardSize;
+  std::vector<feature::Metadata::EType> const m_metadataTypes;
+  mutable std::array<Shard, kShardsCount> m_shards;
+
+  std::atomic<uint64_t> m_hits{0};
+  std::atomic<uint64_t> m_misses{0};
+  std::atomic<uint64_t> m_evictions{0};
+
+  DISALLOW_COPY_AND_MOVE(FeatureAttributesCache);
+};
+
+std::string DebugPrint(FeatureAttributesCache::Stats const & stats);
@@ -1,6 +1,8 @@
 #include "testing/testing.hpp"
 
 #include "indexer/classificator.hpp"
+#include "indexer/drawing_rules.hpp"
+#include "indexer/scales.hpp"
 
 #include "generator/generator_tests_support/test_with_classificator.hpp"
 
@@ -102,3 +104,39 @@ UNIT_CLASS_TEST(TestWithClassificator, Classificator_StableIndex)
   TEST_NOT_EQUAL(type, c.GetTypeForIndex(356 - 1), ()); // Restored underground-fee
   TEST_EQUAL(type, c.GetTypeForIndex(357 - 1), ());
 }
+
+UNIT_CLASS_TEST(TestWithClassificator, Classificator_TypeRulesTable)
+{
+  Classificator const & c = classif();
+  auto const & table = drule::rules().GetTypeRulesTable();
+
+  size_t drawableCount = 0;
+  c.ForEachTree([&](ClassifObject const * p, uint32_t type)
+  {
+    auto const * rules = table.Find(type);
+    TEST_EQUAL(rules != nullptr, p->IsDrawableAny(), (c.GetFullObjectName(type)));
+    if (rules == nullptr)
+      return;
+
+    ++drawableCount;
+    TEST_EQUAL(rules->m_maxOverlaysPriority, p->GetMaxOverlaysPriority(), (c.GetFullObjectName(type)));
+
+    for (int zoom = 0; zoom <= scales::GetUpperStyleScale(); ++zoom)
+    {
+      for (auto const geomType : {feature::GeomType::Point, feature::GeomType::Line, feature::GeomType::Area})
+      {
+        drule::KeysT expected;
+        p->GetSuitable(zoom, geomType, expected);
+
+        auto const keys = table.GetKeys(*rules, zoom, geomType);
+        TEST_EQUAL(keys.size(), expected.size(), (c.GetFullObjectName(type), zoom, geomType));
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+          TEST_EQUAL(keys[i].m_index, expected[i].m_index, (c.GetFullObjectName(type), zoom, geomType));
+          TEST_EQUAL(keys[i].m_priority, expected[i].m_priority, (c.GetFullObjectName(type), zoom, geomType));
+        }
+      }
+    }
+  });
+  TEST_GREATER(drawableCount, 0, ());
+}
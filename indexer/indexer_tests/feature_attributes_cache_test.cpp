@@ -0,0 +1,100 @@
+#include "testing/testing.hpp"
+
+#include "indexer/classificator_loader.hpp"
+#include "indexer/data_source.hpp"
+#include "indexer/feature.hpp"
+#include "indexer/feature_algo.hpp"
+#include "indexer/feature_attributes_cache.hpp"
+
+#include "platform/local_country_file.hpp"
+
+#include <cstdint>
+
+namespace feature_attributes_cache_test
+{
+using namespace std;
+
+class FeatureAttributesCacheTest
+{
+public:
+  FeatureAttributesCacheTest()
+  {
+    classificator::Load();
+    auto const res = m_dataSource.RegisterMap(platform::LocalCountryFile::MakeForTesting("minsk-pass"));
+    TEST_EQUAL(res.second, MwmSet::RegResult::Success, ());
+    m_mwmId = res.first;
+  }
+
+protected:
+  FrozenDataSource m_dataSource;
+  MwmSet::MwmId m_mwmId;
+};
+
+UNIT_CLASS_TEST(FeatureAttributesCacheTest, Smoke)
+{
+  FeatureAttributesCache cache(100 /* maxSize */, {feature::Metadata::FMD_POSTCODE});
+
+  FeaturesLoaderGuard const guard(m_dataSource, m_mwmId);
+  for (uint32_t i = 0; i < 10; ++i)
+  {
+    FeatureID const id(m_mwmId, i);
+    TEST(!cache.Find(id), ());
+
+    auto const attrs = cache.Get(m_dataSource, id);
+    TEST(attrs, ());
+    TEST_EQUAL(cache.Get(m_dataSource, id), attrs, ());
+
+    auto ft = guard.GetFeatureByIndex(i);
+    TEST(attrs->m_types.Equals(feature::TypesHolder(*ft)), ());
+    TEST_EQUAL(attrs->m_names, ft->GetNames(), ());
+    TEST_EQUAL(attrs->m_center, feature::GetCenter(*ft), ());
+    TEST_EQUAL(attrs->m_rank, ft->GetRank(), ());
+    TEST_EQUAL(attrs->m_houseNumber, ft->GetHouseNumber(), ());
+    TEST_EQUAL(attrs->m_metadata.Get(feature::Metadata::FMD_POSTCODE),
+               ft->GetMetadata(feature::Metadata::FMD_POSTCODE), ());
+  }
+
+  auto const stats = cache.GetStats();
+  // Each feature is missed twice: by Find() and by the first Get().
+  TEST_EQUAL(stats.m_misses, 20, (stats));
+  TEST_EQUAL(stats.m_hits, 10, (stats));
+  TEST_EQUAL(stats.m_evictions, 0, (stats));
+  TEST_EQUAL(cache.GetSize(), 10, ());
+
+  cache.Invalidate(FeatureID(m_mwmId, 0));
+  TEST(!cache.Find(FeatureID(m_mwmId, 0)), ());
+  TEST_EQUAL(cache.GetSize(), 9, ());
+
+  cache.Clear();
+  TEST_EQUAL(cache.GetSize(), 0, ());
+}
+
+UNIT_CLASS_TEST(FeatureAttributesCacheTest, Eviction)
+{
+  size_t constexpr kMaxSize = 32;
+  FeatureAttributesCache cache(kMaxSize);
+
+  FeaturesLoaderGuard const guard(m_dataSource, m_mwmId);
+  uint32_t const count = static_cast<uint32_t>(min(guard.GetNumFeatures(), size_t(1000)));
+  for (uint32_t i = 0; i < count; ++i)
+    TEST(cache.Get(*guard.GetFeatureByIndex(i)), ());
+
+  TEST_LESS_OR_EQUAL(cache.GetSize(), kMaxSize, ());
+  TEST_EQUAL(cache.GetStats().m_evictions, count - cache.GetSize(), ());
+}
+
+UNIT_CLASS_TEST(FeatureAttributesCacheTest, Deregistration)
+{
+  FeatureAttributesCache cache(100 /* maxSize */);
+  m_dataSource.AddObserver(cache);
+
+  FeatureID const id(m_mwmId, 0);
+  TEST(cache.Get(m_dataSource, id), ());
+  TEST_EQUAL(cache.GetSize(), 1, ());
+
+  TEST(m_dataSource.DeregisterMap(platform::CountryFile("minsk-pass")), ());
+  TEST_EQUAL(cache.GetSize(), 0, ());
+
+  m_dataSource.RemoveObserver(cache);
+}
+}  // namespace feature_attributes_cache_test
@@ -0,0 +1,137 @@
+#include "testing/testing.hpp"
+
+#include "indexer/data_source.hpp"
+#include "indexer/mwm_registry_cache.hpp"
+#include "indexer/scales.hpp"
+
+#include "platform/local_country_file.hpp"
+#include "platform/platform.hpp"
+
+#include "coding/file_writer.hpp"
+#include "coding/internal/file_data.hpp"
+
+#include "base/file_name_utils.hpp"
+#include "base/scope_guard.hpp"
+
+#include <memory>
+#include <string>
+
+namespace mwm_registry_cache_test
+{
+using namespace std;
+
+MwmRegistryCache::Entry MakeEntry(double size, uint64_t seconds)
+{
+  MwmRegistryCache::Entry entry;
+  entry.m_bordersRect = m2::RectD(-size, -size / 2, size, size / 2);
+  entry.m_minScale = 1;
+  entry.m_maxScale = 17;
+  entry.m_version.SetFormat(version::Format::lastFormat);
+  entry.m_version.SetSecondsSinceEpoch(seconds);
+  entry.m_data.SetLanguages({"en", "fr"});
+  entry.m_data.Set(feature::RegionData::RD_DRIVING, "l");
+  return entry;
+}
+
+void TestEqual(MwmRegistryCache::Entry const & lhs, MwmRegistryCache::Entry const & rhs)
+{
+  TEST_EQUAL(lhs.m_bordersRect, rhs.m_bordersRect, ());
+  TEST_EQUAL(lhs.m_minScale, rhs.m_minScale, ());
+  TEST_EQUAL(lhs.m_maxScale, rhs.m_maxScale, ());
+  TEST_EQUAL(lhs.m_version.GetFormat(), rhs.m_version.GetFormat(), ());
+  TEST_EQUAL(lhs.m_version.GetSecondsSinceEpoch(), rhs.m_version.GetSecondsSinceEpoch(), ());
+  TEST(lhs.m_data.Equals(rhs.m_data), ());
+}
+
+UNIT_TEST(MwmRegistryCache_SaveLoad)
+{
+  string const path = base::JoinPath(GetPlatform().WritableDir(), "mwm_registry_test.bin");
+  SCOPE_GUARD(cleanup, bind(&FileWriter::DeleteFileX, path));
+
+  auto const entry1 = MakeEntry(10.0, 1000);
+  auto const entry2 = MakeEntry(20.5, 2000);
+  {
+    MwmRegistryCache cache;
+    TEST(!cache.Load(path), ());
+    cache.Add("a.mwm", 100, 10, entry1);
+    cache.Add("b.mwm", 200, 20, entry2);
+    TEST(cache.IsChanged(), ());
+    TEST(cache.Save(path), ());
+    TEST(!cache.IsChanged(), ());
+  }
+
+  {
+    MwmRegistryCache cache;
+    TEST(cache.Load(path), ());
+    TEST_EQUAL(cache.GetSize(), 2, ());
+
+    // Entries of changed files are not found.
+    TEST(!cache.Find("a.mwm", 101, 10), ());
+    TEST(!cache.Find("a.mwm", 100, 11), ());
+    TEST(!cache.Find("c.mwm", 100, 10), ());
+
+    auto const found = cache.Find("b.mwm", 200, 20);
+    TEST(found, ());
+    TestEqual(*found, entry2);
+
+    // Not used entry of "a.mwm" is dropped on saving.
+    TEST(cache.IsChanged(), ());
+    TEST(cache.Save(path), ());
+  }
+
+  {
+    MwmRegistryCache cache;
+    TEST(cache.Load(path), ());
+    TEST_EQUAL(cache.GetSize(), 1, ());
+    TEST(!cache.Find("a.mwm", 100, 10), ());
+    TEST(cache.Find("b.mwm", 200, 20), ());
+    TEST(!cache.IsChanged(), ());
+  }
+}
+
+UNIT_TEST(MwmRegistryCache_DataSource)
+{
+  string const path = base::JoinPath(GetPlatform().WritableDir(), "mwm_registry_test.bin");
+  SCOPE_GUARD(cleanup, bind(&FileWriter::DeleteFileX, path));
+
+  auto const localFile = platform::LocalCountryFile::MakeForTesting("minsk-pass");
+  TEST(localFile.OnDisk(MapFileType::Map), ());
+
+  MwmSet::MwmId readId;
+  {
+    auto cache = make_shared<MwmRegistryCache>();
+    FrozenDataSource dataSource;
+    dataSource.SetRegistryCache(cache);
+    auto const result = dataSource.RegisterMap(localFile);
+    TEST_EQUAL(result.second, MwmSet::RegResult::Success, ());
+    readId = result.first;
+
+    TEST_EQUAL(cache->GetSize(), 1, ());
+    TEST(cache->Save(path), ());
+  }
+
+  auto cache = make_shared<MwmRegistryCache>();
+  TEST(cache->Load(path), ());
+
+  FrozenDataSource dataSource;
+  dataSource.SetRegistryCache(cache);
+  auto const result = dataSource.RegisterMap(localFile);
+  TEST_EQUAL(result.second, MwmSet::RegResult::Success, ());
+
+  // The mwm is registered from the cache, so the cache is not changed.
+  TEST(!cache->IsChanged(), ());
+
+  auto const & cachedInfo = *result.first.GetInfo();
+  auto const & readInfo = *readId.GetInfo();
+  TEST_EQUAL(cachedInfo.m_bordersRect, readInfo.m_bordersRect, ());
+  TEST_EQUAL(cachedInfo.m_minScale, readInfo.m_minScale, ());
+  TEST_EQUAL(cachedInfo.m_maxScale, readInfo.m_maxScale, ());
+  TEST_EQUAL(cachedInfo.m_version.GetVersion(), readInfo.m_version.GetVersion(), ());
+  TEST(cachedInfo.GetRegionData().Equals(readInfo.GetRegionData()), ());
+
+  // Features of the mwm registered from the cache are read.
+  size_t count = 0;
+  dataSource.ForEachInScale([&count](FeatureType &) { ++count; }, scales::GetUpperScale());
+  TEST_GREATER(count, 0, ());
+}
+}  // namespace mwm_registry_cache_test
@@ -8,7 +8,10 @@
 #include "base/macros.hpp"
 
 #include <initializer_list>
+#include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace mwm_set_test
 {
@@ -169,4 +172,184 @@ UNIT_TEST(MwmSetLockAndIdTest)
   TEST(!handle.GetId().IsAlive(), ());
   TEST(!handle.GetId().GetInfo().get(), ());
 }
+
+UNIT_TEST(MwmSetUpdateVersionTest)
+{
+  ScopedMwm mwm5("5.mwm");
+  TestMwmSet mwmSet;
+
+  auto const oldId = mwmSet.Register(LocalCountryFile::MakeForTesting("5", 1 /* version */)).first;
+  TEST(oldId.IsAlive(), ());
+
+  {
+    MwmSet::MwmHandle const oldHandle = mwmSet.GetMwmHandleById(oldId);
+    TEST(oldHandle.IsAlive(), ());
+
+    // The new version is used right away, the old one is deregistered when it's released.
+    auto const res = mwmSet.Register(LocalCountryFile::MakeForTesting("5", 2 /* version */));
+    TEST_EQUAL(MwmSet::RegResult::Success, res.second, ());
+    TEST_NOT_EQUAL(res.first, oldId, ());
+    TEST(oldHandle.IsAlive(), ());
+    TEST_EQUAL(MwmInfo::STATUS_MARKED_TO_DEREGISTER, oldId.GetInfo()->GetStatus(), ());
+
+    MwmSet::MwmHandle const newHandle = mwmSet.GetMwmHandleByCountryFile(CountryFile("5"));
+    TEST(newHandle.IsAlive(), ());
+    TEST_EQUAL(newHandle.GetId(), res.first, ());
+    TEST_EQUAL(2, newHandle.GetInfo()->GetVersion(), ());
+
+    TEST_EQUAL(MwmSet::RegResult::VersionTooOld,
+               mwmSet.Register(LocalCountryFile::MakeForTesting("5", 1 /* version */)).second, ());
+  }
+
+  TEST_EQUAL(MwmInfo::STATUS_DEREGISTERED, oldId.GetInfo()->GetStatus(), ());
+  TEST_EQUAL(2, mwmSet.GetMwmIdByCountryFile(CountryFile("5")).GetInfo()->GetVersion(), ());
+}
+
+UNIT_TEST(MwmSetCacheTest)
+{
+  ScopedMwm mwm1("1.mwm");
+  ScopedMwm mwm2("2.mwm");
+  ScopedMwm mwm3("3.mwm");
+
+  TestMwmSet mwmSet(2 /* cacheSize */);
+  for (auto const * name : {"1", "2", "3"})
+    TEST_EQUAL(MwmSet::RegResult::Success, mwmSet.Register(LocalCountryFile::MakeForTesting(name)).second, ());
+
+  auto const lockAndRelease = [&mwmSet](string const & name)
+  {
+    TEST(mwmSet.GetMwmHandleByCountryFile(CountryFile(name)).IsAlive(), (name));
+  };
+
+  lockAndRelease("1");
+  lockAndRelease("2");
+  TEST_EQUAL(mwmSet.GetCreatedValuesCount(), 2, ());
+
+  // Cached values are reused, the value of "1" becomes the most recently used one.
+  lockAndRelease("1");
+  TEST_EQUAL(mwmSet.GetCreatedValuesCount(), 2, ());
+
+  // The least recently used value of "2" is evicted.
+  lockAndRelease("3");
+  TEST_EQUAL(mwmSet.GetCreatedValuesCount(), 3, ());
+  lockAndRelease("1");
+  lockAndRelease("3");
+  TEST_EQUAL(mwmSet.GetCreatedValuesCount(), 3, ());
+  lockAndRelease("2");
+  TEST_EQUAL(mwmSet.GetCreatedValuesCount(), 4, ());
+
+  // Simultaneous handles of the same mwm have their own values.
+  {
+    auto const handle1 = mwmSet.GetMwmHandleByCountryFile(CountryFile("3"));
+    auto const handle2 = mwmSet.GetMwmHandleByCountryFile(CountryFile("3"));
+    TEST(handle1.IsAlive(), ());
+    TEST(handle2.IsAlive(), ());
+    TEST_NOT_EQUAL(handle1.GetValue(), handle2.GetValue(), ());
+    TEST_EQUAL(mwmSet.GetCreatedValuesCount(), 5, ());
+    TEST_EQUAL(handle1.GetId().GetInfo()->GetNumRefs(), 2, ());
+  }
+
+  // Values of the deregistered mwm are dropped.
+  TEST(mwmSet.Deregister(CountryFile("3")), ());
+  TEST(!mwmSet.GetMwmHandleByCountryFile(CountryFile("3")).IsAlive(), ());
+
+  mwmSet.ClearCache();
+  lockAndRelease("2");
+  TEST_EQUAL(mwmSet.GetCreatedValuesCount(), 6, ());
+}
+
+UNIT_TEST(MwmSetConcurrentHandlesTest)
+{
+  ScopedMwm mwm1("1.mwm");
+  ScopedMwm mwm2("2.mwm");
+
+  TestMwmSet mwmSet;
+  auto const id1 = mwmSet.Register(LocalCountryFile::MakeForTesting("1")).first;
+  auto const id2 = mwmSet.Register(LocalCountryFile::MakeForTesting("2")).first;
+
+  size_t constexpr kThreadsCount = 8;
+  size_t constexpr kIterationsCount = 200;
+
+  // Results are checked on the main thread.
+  struct Result
+  {
+    size_t m_alive1 = 0;
+    size_t m_alive2 = 0;
+    size_t m_sameId2 = 0;
+  };
+  vector<Result> results(kThreadsCount);
+
+  vector<thread> threads;
+  for (size_t i = 0; i < kThreadsCount; ++i)
+  {
+    threads.emplace_back([&mwmSet, &id1, &id2, &result = results[i]]()
+    {
+      for (size_t j = 0; j < kIterationsCount; ++j)
+      {
+        auto const handle1 = mwmSet.GetMwmHandleById(id1);
+        auto const handle2 = mwmSet.GetMwmHandleByCountryFile(CountryFile("2"));
+        result.m_alive1 += handle1.IsAlive() ? 1 : 0;
+        result.m_alive2 += handle2.IsAlive() ? 1 : 0;
+        result.m_sameId2 += handle2.GetId() == id2 ? 1 : 0;
+      }
+    });
+  }
+
+  for (auto & t : threads)
+    t.join();
+
+  for (auto const & result : results)
+  {
+    TEST_EQUAL(result.m_alive1, kIterationsCount, ());
+    TEST_EQUAL(result.m_alive2, kIterationsCount, ());
+    TEST_EQUAL(result.m_sameId2, kIterationsCount, ());
+  }
+
+  TEST_EQUAL(id1.GetInfo()->GetNumRefs(), 0, ());
+  TEST_EQUAL(id2.GetInfo()->GetNumRefs(), 0, ());
+
+  TEST(mwmSet.Deregister(CountryFile("1")), ());
+  TEST(mwmSet.Deregister(CountryFile("2")), ());
+}
+
+UNIT_TEST(MwmSetConcurrentDeregisterTest)
+{
+  ScopedMwm mwm1("1.mwm");
+
+  TestMwmSet mwmSet;
+  auto const id = mwmSet.Register(LocalCountryFile::MakeForTesting("1")).first;
+
+  size_t constexpr kThreadsCount = 4;
+  size_t constexpr kIterationsCount = 1000;
+
+  // Every thread takes handles of the mwm and counts the handles which were alive after
+  // the mwm was seen deregistered.
+  vector<size_t> aliveAfterDeregister(kThreadsCount, 0);
+  vector<thread> threads;
+  for (size_t i = 0; i < kThreadsCount; ++i)
+  {
+    threads.emplace_back([&mwmSet, &id, &alive = aliveAfterDeregister[i]]()
+    {
+      for (size_t j = 0; j < kIterationsCount; ++j)
+      {
+        bool const deregistered = id.GetInfo()->GetStatus() == MwmInfo::STATUS_DEREGISTERED;
+        auto const handle = mwmSet.GetMwmHandleById(id);
+        if (deregistered && handle.IsAlive())
+          ++alive;
+      }
+    });
+  }
+
+  mwmSet.Deregister(CountryFile("1"));
+
+  for (auto & t : threads)
+    t.join();
+
+  for (size_t alive : aliveAfterDeregister)
+    TEST_EQUAL(alive, 0, ());
+
+  // The mwm is deregistered by the last released handle if it was used.
+  TEST_EQUAL(id.GetInfo()->GetStatus(), MwmInfo::STATUS_DEREGISTERED, ());
+  TEST_EQUAL(id.GetInfo()->GetNumRefs(), 0, ());
+  TEST(!mwmSet.GetMwmHandleById(id).IsAlive(), ());
+}
 }  // namespace mwm_set_test
@@ -35,3 +35,31 @@ UNIT_TEST(ReadFeatures_Smoke)
     ft1->ForEachType([](auto const /* t */) {});
   }
 }
+
+UNIT_TEST(ReadFeatures_MappedMode)
+{
+  classificator::Load();
+
+  auto const localFile = platform::LocalCountryFile::MakeForTesting("minsk-pass");
+
+  FrozenDataSource cachedDataSource;
+  auto const cachedId = cachedDataSource.RegisterMap(localFile).first;
+  FrozenDataSource mappedDataSource(MwmValue::ReadMode::Mapped);
+  auto const mappedId = mappedDataSource.RegisterMap(localFile).first;
+
+  auto const handle = mappedDataSource.GetMwmHandleById(mappedId);
+  TEST(handle.IsAlive(), ());
+  TEST_EQUAL(handle.GetValue()->GetReadMode(), MwmValue::ReadMode::Mapped, ());
+
+  FeaturesLoaderGuard const cachedGuard(cachedDataSource, cachedId);
+  FeaturesLoaderGuard const mappedGuard(mappedDataSource, mappedId);
+  TEST_EQUAL(cachedGuard.GetNumFeatures(), mappedGuard.GetNumFeatures(), ());
+
+  for (uint32_t i = 0; i < mappedGuard.GetNumFeatures(); ++i)
+  {
+    auto ft1 = cachedGuard.GetFeatureByIndex(i);
+    auto ft2 = mappedGuard.GetFeatureByIndex(i);
+
+    TEST_EQUAL(ft1->DebugString(), ft2->DebugString(), (i));
+  }
+}
@@ -8,6 +8,8 @@
 
 #include "geometry/rect2d.hpp"
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
 
 using platform::CountryFile;
@@ -18,6 +20,11 @@ namespace tests
 
 class TestMwmSet : public MwmSet
 {
+public:
+  explicit TestMwmSet(size_t cacheSize = 64) : MwmSet(cacheSize) {}
+
+  size_t GetCreatedValuesCount() const { return m_createdValuesCount; }
+
 protected:
   /// @name MwmSet overrides
   //@{
@@ -31,11 +38,15 @@ protected:
     return info;
   }
 
-  std::unique_ptr<MwmValue> CreateValue(MwmInfo & info) const override
+  std::unique_ptr<MwmValue> CreateValue(MwmInfo &, platform::LocalCountryFile const & localFile) const override
   {
-    return std::make_unique<MwmValue>(info.GetLocalFile());
+    ++m_createdValuesCount;
+    return std::make_unique<MwmValue>(localFile);
   }
   //@}
+
+private:
+  mutable std::atomic<size_t> m_createdValuesCount{0};
 };
 
 }  // namespace
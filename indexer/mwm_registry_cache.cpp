@@ -0,0 +1,194 @@
+#include "indexer/mwm_registry_cache.hpp"
+
+#include "coding/file_reader.hpp"
+#include "coding/file_writer.hpp"
+#include "coding/internal/file_data.hpp"
+#include "coding/read_write_utils.hpp"
+#include "coding/reader.hpp"
+#include "coding/write_to_sink.hpp"
+
+#include "base/logging.hpp"
+
+#include <bit>
+#include <utility>
+
+namespace
+{
+// Should be increased when the format or the content of an entry is changed.
+uint32_t constexpr kFormatVersion = 0;
+
+template <typename Sink>
+void WriteDouble(Sink & sink, double value)
+{
+  WriteToSink(sink, std::bit_cast<uint64_t>(value));
+}
+
+template <typename Source>
+double ReadDouble(Source & src)
+{
+  return std::bit_cast<double>(ReadPrimitiveFromSource<uint64_t>(src));
+}
+}  // namespace
+
+bool MwmRegistryCache::Load(std::string const & path)
+{
+  std::map<std::string, Item> items;
+  bool isLoaded = false;
+  try
+  {
+    FileReader reader(path);
+    ReaderSource<FileReader> src(reader);
+    auto const formatVersion = ReadPrimitiveFromSource<uint32_t>(src);
+    if (formatVersion == kFormatVersion)
+    {
+      auto const count = ReadPrimitiveFromSource<uint32_t>(src);
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        std::string filePath;
+        rw::Read(src, filePath);
+
+        Item item;
+        item.m_fileSize = ReadPrimitiveFromSource<uint64_t>(src);
+        item.m_modificationTime = ReadPrimitiveFromSource<int64_t>(src);
+
+        auto & entry = item.m_entry;
+        double const minX = ReadDouble(src);
+        double const minY = ReadDouble(src);
+        double const maxX = ReadDouble(src);
+        double const maxY = ReadDouble(src);
+        entry.m_bordersRect = m2::RectD(minX, minY, maxX, maxY);
+        entry.m_minScale = ReadPrimitiveFromSource<uint8_t>(src);
+        entry.m_maxScale = ReadPrimitiveFromSource<uint8_t>(src);
+        entry.m_version.SetFormat(static_cast<version::Format>(ReadPrimitiveFromSource<int32_t>(src)));
+        entry.m_version.SetSecondsSinceEpoch(ReadPrimitiveFromSource<uint64_t>(src));
+        entry.m_data.Deserialize(src);
+
+        items.emplace(std::move(filePath), std::move(item));
+      }
+      isLoaded = true;
+    }
+    else
+    {
+      LOG(LINFO, ("Mwm registry cache of format", formatVersion, "is dropped."));
+    }
+  }
+  catch (RootException const & ex)
+  {
+    LOG(LINFO, ("Can't load mwm registry cache", path, ex.Msg()));
+  }
+
+  std::lock_guard lock(m_mutex);
+  if (!isLoaded)
+    items.clear();
+  m_items = std::move(items);
+  m_isChanged = !isLoaded;
+  return isLoaded;
+}
+
+bool MwmRegistryCache::Save(std::string const & path)
+{
+  std::lock_guard lock(m_mutex);
+
+  // Unused entries are dropped.
+  for (auto it = m_items.begin(); it != m_items.end();)
+  {
+    if (it->second.m_isUsed)
+      ++it;
+    else
+      it = m_items.erase(it);
+  }
+
+  std::string const tmpPath = path + ".tmp";
+  try
+  {
+    {
+      FileWriter writer(tmpPath);
+      WriteToSink(writer, kFormatVersion);
+      WriteToSink(writer, static_cast<uint32_t>(m_items.size()));
+      for (auto const & [filePath, item] : m_items)
+      {
+        rw::Write(writer, filePath);
+        WriteToSink(writer, item.m_fileSize);
+        WriteToSink(writer, item.m_modificationTime);
+
+        auto const & entry = item.m_entry;
+        WriteDouble(writer, entry.m_bordersRect.minX());
+        WriteDouble(writer, entry.m_bordersRect.minY());
+        WriteDouble(writer, entry.m_bordersRect.maxX());
+        WriteDouble(writer, entry.m_bordersRect.maxY());
+        WriteToSink(writer, entry.m_minScale);
+        WriteToSink(writer, entry.m_maxScale);
+        WriteToSink(writer, static_cast<int32_t>(entry.m_version.GetFormat()));
+        WriteToSink(writer, entry.m_version.GetSecondsSinceEpoch());
+        entry.m_data.Serialize(writer);
+      }
+    }
+
+    if (!base::RenameFileX(tmpPath, path))
+    {
+      LOG(LWARNING, ("Can't rename", tmpPath, "to", path));
+      base::DeleteFileX(tmpPath);
+      return false;
+    }
+  }
+  catch (RootException const & ex)
+  {
+    LOG(LWARNING, ("Can't save mwm registry cache", path, ex.Msg()));
+    base::DeleteFileX(tmpPath);
+    return false;
+  }
+
+  m_isChanged = false;
+  return true;
+}
+
+std::optional<MwmRegistryCache::Entry> MwmRegistryCache::Find(std::string const & filePath,
+                                                              uint64_t fileSize, time_t modificationTime)
+{
+  std::lock_guard lock(m_mutex);
+  auto const it = m_items.find(filePath);
+  if (it == m_items.end())
+    return {};
+
+  auto & item = it->second;
+  if (item.m_fileSize != fileSize || item.m_modificationTime != static_cast<int64_t>(modificationTime))
+    return {};
+
+  item.m_isUsed = true;
+  return item.m_entry;
+}
+
+void MwmRegistryCache::Add(std::string const & filePath, uint64_t fileSize, time_t modificationTime,
+                           Entry const & entry)
+{
+  Item item;
+  item.m_fileSize = fileSize;
+  item.m_modificationTime = static_cast<int64_t>(modificationTime);
+  item.m_entry = entry;
+  item.m_isUsed = true;
+
+  std::lock_guard lock(m_mutex);
+  m_items[filePath] = std::move(item);
+  m_isChanged = true;
+}
+
+bool MwmRegistryCache::IsChanged() const
+{
+  std::lock_guard lock(m_mutex);
+  if (m_isChanged)
+    return true;
+
+  // Not used entries are dropped on saving.
+  for (auto const & item : m_items)
+  {
+    if (!item.second.m_isUsed)
+      return true;
+  }
+  return false;
+}
+
+size_t MwmRegistryCache::GetSize() const
+{
+  std::lock_guard lock(m_mutex);
+  return m_items.size();
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "indexer/feature_meta.hpp"
+
+#include "platform/mwm_version.hpp"
+
+#include "geometry/rect2d.hpp"
+
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+
+/// Persisted cache of mwm properties which are read from an mwm file on its registration.
+/// Entries are keyed by the path, size and modification time of the file, so an unchanged
+/// mwm is registered without opening it. All methods are thread-safe.
+class MwmRegistryCache
+{
+public:
+  struct Entry
+  {
+    m2::RectD m_bordersRect;
+    uint8_t m_minScale = 0;
+    uint8_t m_maxScale = 0;
+    version::MwmVersion m_version;
+    feature::RegionData m_data;
+  };
+
+  /// Replaces entries by the ones from |path|.
+  /// \returns false if the file is absent or broken, the cache is empty then.
+  bool Load(std::string const & path);
+  /// Saves entries which were found or added since the loading, so entries of removed
+  /// and updated mwms are dropped.
+  bool Save(std::string const & path);
+
+  std::optional<Entry> Find(std::string const & filePath, uint64_t fileSize, time_t modificationTime);
+  void Add(std::string const & filePath, uint64_t fileSize, time_t modificationTime, Entry const & entry);
+
+  /// \returns true if the saved cache differs from the current one.
+  bool IsChanged() const;
+  size_t GetSize() const;
+
+private:
+  struct Item
+  {
+    uint64_t m_fileSize = 0;
+    int64_t m_modificationTime = 0;
+    Entry m_entry;
+    bool m_isUsed = false;
+  };
+
+  mutable std::mutex m_mutex;
+  std::map<std::string, Item> m_items;
+  bool m_isChanged = false;
+};
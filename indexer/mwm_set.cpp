@@ -3,6 +3,7 @@
 #include "indexer/features_offsets_table.hpp"
 #include "indexer/scales.hpp"
 
+#include "coding/mmap_reader.hpp"
 #include "coding/reader.hpp"
 
 #include "platform/local_country_file_utils.hpp"
@@ -21,7 +22,17 @@ using namespace std;
 using platform::CountryFile;
 using platform::LocalCountryFile;
 
-MwmInfo::MwmInfo() : m_minScale(0), m_maxScale(0), m_status(STATUS_DEREGISTERED), m_numRefs(0) {}
+MwmInfo::MwmInfo() : m_minScale(0), m_maxScale(0), m_status(STATUS_DEREGISTERED), m_numRefs(0)
+{
+  for (auto & value : m_cachedValues)
+    value = nullptr;
+}
+
+MwmInfo::~MwmInfo()
+{
+  for (auto & value : m_cachedValues)
+    delete value.exchange(nullptr);
+}
 
 MwmInfo::MwmTypeT MwmInfo::GetType() const
 {
@@ -85,6 +96,11 @@ MwmSet::MwmHandle & MwmSet::MwmHandle::operator=(MwmHandle && handle)
   return *this;
 }
 
+MwmSet::~MwmSet()
+{
+  ClearCache();
+}
+
 MwmSet::MwmId MwmSet::GetMwmIdByCountryFileImpl(CountryFile const & countryFile) const
 {
   string const & name = countryFile.GetName();
@@ -97,14 +113,32 @@ MwmSet::MwmId MwmSet::GetMwmIdByCountryFileImpl(CountryFile const & countryFile)
 
 pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const & localFile)
 {
+  CountryFile const & countryFile = localFile.GetCountryFile();
+
+  // A new file is opened out of the lock, so handles of other mwms and of the previous version
+  // of this mwm may be taken while it's being read. Then the old version is replaced by the new
+  // one at once: it's deregistered right away or when its last handle is released.
+  shared_ptr<MwmInfo> newInfo;
+  {
+    unique_lock<mutex> lock(m_lock);
+    MwmId const id = GetMwmIdByCountryFileImpl(countryFile);
+    if (!id.IsAlive() || id.GetInfo()->GetVersion() < localFile.GetVersion())
+    {
+      lock.unlock();
+      // This function can throw an exception for a bad mwm file.
+      newInfo = CreateInfo(localFile);
+      if (!newInfo)
+        return make_pair(MwmId(), RegResult::UnsupportedFileFormat);
+    }
+  }
+
   pair<MwmSet::MwmId, MwmSet::RegResult> result;
   auto registerFile = [&](EventList & events)
   {
-    CountryFile const & countryFile = localFile.GetCountryFile();
     MwmId const id = GetMwmIdByCountryFileImpl(countryFile);
     if (!id.IsAlive())
     {
-      result = RegisterImpl(localFile, events);
+      result = newInfo ? RegisterImpl(std::move(newInfo), localFile, events) : RegisterImpl(localFile, events);
       return;
     }
 
@@ -114,7 +148,7 @@ pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::Register(LocalCountryFile const &
     if (info->GetVersion() < localFile.GetVersion())
     {
       DeregisterImpl(id, events);
-      result = RegisterImpl(localFile, events);
+      result = newInfo ? RegisterImpl(std::move(newInfo), localFile, events) : RegisterImpl(localFile, events);
       return;
     }
 
@@ -143,7 +177,13 @@ pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::RegisterImpl(LocalCountryFile con
                                                             EventList & events)
 {
   // This function can throw an exception for a bad mwm file.
-  shared_ptr<MwmInfo> info(CreateInfo(localFile));
+  return RegisterImpl(CreateInfo(localFile), localFile, events);
+}
+
+pair<MwmSet::MwmId, MwmSet::RegResult> MwmSet::RegisterImpl(shared_ptr<MwmInfo> info,
+                                                            LocalCountryFile const & localFile,
+                                                            EventList & events)
+{
   if (!info)
     return make_pair(MwmId(), RegResult::UnsupportedFileFormat);
 
@@ -160,24 +200,19 @@ bool MwmSet::DeregisterImpl(MwmId const & id, EventList & events)
     return false;
 
   shared_ptr<MwmInfo> const & info = id.GetInfo();
-  if (info->m_numRefs == 0)
-  {
-    SetStatus(*info, MwmInfo::STATUS_DEREGISTERED, events);
-    vector<shared_ptr<MwmInfo>> & infos = m_info[info->GetCountryName()];
-    infos.erase(remove(infos.begin(), infos.end(), info), infos.end());
-    for (auto it = m_cache.begin(); it != m_cache.end(); ++it)
-    {
-      if (it->first == id)
-      {
-        m_cache.erase(it);
-        break;
-      }
-    }
-    return true;
-  }
-
+  // Handles are acquired without |m_lock|, so the mwm is marked first and then it's deregistered
+  // only if it has no handles, atomically with forbidding of new ones. Otherwise the mwm is
+  // deregistered when its last handle is released.
   SetStatus(*info, MwmInfo::STATUS_MARKED_TO_DEREGISTER, events);
-  return false;
+  uint32_t numRefs = 0;
+  if (!info->m_numRefs.compare_exchange_strong(numRefs, MwmInfo::kDeregisteredRefs))
+    return false;
+
+  SetStatus(*info, MwmInfo::STATUS_DEREGISTERED, events);
+  vector<shared_ptr<MwmInfo>> & infos = m_info[info->GetCountryName()];
+  infos.erase(remove(infos.begin(), infos.end(), info), infos.end());
+  ClearCache(id);
+  return true;
 }
 
 bool MwmSet::Deregister(CountryFile const & countryFile)
@@ -257,105 +292,182 @@ void MwmSet::ProcessEventList(EventList & events)
 
 unique_ptr<MwmValue> MwmSet::LockValue(MwmId const & id)
 {
-  unique_ptr<MwmValue> result;
-  WithEventLog([&](EventList & events)
-               {
-                 result = LockValueImpl(id, events);
-               });
-  return result;
+  // It's better to return valid "value pointer" even for "out-of-date" files,
+  // because they can be locked for a long time by other algos.
+  if (!id.IsAlive() || !AddRef(*id.GetInfo()))
+    return nullptr;
+  return TakeOrCreateValue(id);
 }
 
-unique_ptr<MwmValue> MwmSet::LockValueImpl(MwmId const & id, EventList & events)
+// static
+bool MwmSet::AddRef(MwmInfo & info)
 {
-  if (!id.IsAlive())
-    return nullptr;
-  shared_ptr<MwmInfo> info = id.GetInfo();
-
-  // It's better to return valid "value pointer" even for "out-of-date" files,
-  // because they can be locked for a long time by other algos.
-  //if (!info->IsUpToDate())
-  //  return TMwmValuePtr();
+  uint32_t numRefs = info.m_numRefs.load();
+  do
+  {
+    if (numRefs & MwmInfo::kDeregisteredRefs)
+      return false;
+  } while (!info.m_numRefs.compare_exchange_weak(numRefs, numRefs + 1));
+  return true;
+}
 
-  ++info->m_numRefs;
+unique_ptr<MwmValue> MwmSet::TakeOrCreateValue(MwmId const & id)
+{
+  shared_ptr<MwmInfo> const & info = id.GetInfo();
+  if (auto value = TakeFromCache(*info))
+    return value;
 
-  // Search in cache.
-  for (auto it = m_cache.begin(); it != m_cache.end(); ++it)
+  // The file may be updated by Register() while a new value is being created, so it's copied.
+  LocalCountryFile localFile;
   {
-    if (it->first == id)
-    {
-      unique_ptr<MwmValue> result = std::move(it->second);
-      m_cache.erase(it);
-      return result;
-    }
+    lock_guard<mutex> lock(m_lock);
+    localFile = info->GetLocalFile();
   }
 
+  // Creation of a new value (file opening, header and offsets table reading) is the most
+  // expensive part, so it's done without |m_lock| to let other threads acquire their handles.
+  // The mwm can't be deregistered meanwhile because it's referenced.
   try
   {
-    return CreateValue(*info);
+    return CreateValue(*info, localFile);
   }
   catch (Reader::TooManyFilesException const & ex)
   {
-    LOG(LERROR, ("Too many open files, can't open:", info->GetCountryName()));
-    --info->m_numRefs;
+    LOG(LERROR, ("Too many open files, can't open:", localFile.GetCountryName()));
+    ReleaseRef(id);
     return nullptr;
   }
   catch (exception const & ex)
   {
-    LOG(LERROR, ("Can't create MWMValue for", info->GetCountryName(), "Reason", ex.what()));
-
-    --info->m_numRefs;
-    DeregisterImpl(id, events);
+    LOG(LERROR, ("Can't create MWMValue for", localFile.GetCountryName(), "Reason", ex.what()));
+    WithEventLog([&](EventList & events)
+                 {
+                   --info->m_numRefs;
+                   DeregisterImpl(id, events);
+                 });
     return nullptr;
   }
 }
 
-void MwmSet::UnlockValue(MwmId const & id, unique_ptr<MwmValue> p)
+unique_ptr<MwmValue> MwmSet::TakeFromCache(MwmInfo & info)
+{
+  for (auto & cachedValue : info.m_cachedValues)
+  {
+    if (cachedValue.load() == nullptr)
+      continue;
+
+    if (MwmValue * value = cachedValue.exchange(nullptr))
+    {
+      --m_cachedValuesCount;
+      return unique_ptr<MwmValue>(value);
+    }
+  }
+  return nullptr;
+}
+
+void MwmSet::ReleaseRef(MwmId const & id)
 {
+  shared_ptr<MwmInfo> const & info = id.GetInfo();
+  uint32_t const numRefs = info->m_numRefs.fetch_sub(1);
+  ASSERT_GREATER(numRefs & ~MwmInfo::kDeregisteredRefs, 0, ());
+  if (numRefs != 1 || info->GetStatus() != MwmInfo::STATUS_MARKED_TO_DEREGISTER)
+    return;
+
+  // The status is checked again under the lock because the mwm may be registered again meanwhile.
   WithEventLog([&](EventList & events)
                {
-                 UnlockValueImpl(id, std::move(p), events);
+                 if (info->GetStatus() == MwmInfo::STATUS_MARKED_TO_DEREGISTER)
+                   DeregisterImpl(id, events);
                });
 }
 
-void MwmSet::UnlockValueImpl(MwmId const & id, unique_ptr<MwmValue> p, EventList & events)
+void MwmSet::UnlockValue(MwmId const & id, unique_ptr<MwmValue> p)
 {
   ASSERT(id.IsAlive(), (id));
   ASSERT(p.get() != nullptr, ());
   if (!id.IsAlive() || !p)
     return;
 
-  shared_ptr<MwmInfo> const & info = id.GetInfo();
-  ASSERT_GREATER(info->m_numRefs, 0, ());
-  --info->m_numRefs;
-  if (info->m_numRefs == 0 && info->GetStatus() == MwmInfo::STATUS_MARKED_TO_DEREGISTER)
-    VERIFY(DeregisterImpl(id, events), ());
+  // Not cached and evicted values are destroyed (and their files are closed) without locks.
+  vector<unique_ptr<MwmValue>> evicted;
+  if (id.GetInfo()->IsUpToDate())
+    PutToCache(id, p, evicted);
+  ReleaseRef(id);
+}
+
+bool MwmSet::PutToCache(MwmId const & id, unique_ptr<MwmValue> & value, vector<unique_ptr<MwmValue>> & evicted)
+{
+  MwmInfo & info = *id.GetInfo();
+
+  // The counter is incremented in advance to not be decremented below zero by a concurrent taker.
+  ++m_cachedValuesCount;
+  bool cached = false;
+  for (auto & cachedValue : info.m_cachedValues)
+  {
+    MwmValue * empty = nullptr;
+    if (cachedValue.compare_exchange_strong(empty, value.get()))
+    {
+      value.release();
+      cached = true;
+      break;
+    }
+  }
+
+  if (!cached)
+  {
+    --m_cachedValuesCount;
+    return false;
+  }
+
+  lock_guard<mutex> lock(m_cacheLock);
+  auto const it = m_cacheLruIndex.find(&info);
+  if (it != m_cacheLruIndex.end())
+    m_cacheLru.splice(m_cacheLru.end(), m_cacheLru, it->second);
+  else
+    m_cacheLruIndex.emplace(&info, m_cacheLru.insert(m_cacheLru.end(), id));
 
-  if (info->IsUpToDate())
+  while (m_cachedValuesCount > m_cacheSize && !m_cacheLru.empty())
   {
-    /// @todo Probably, it's better to store only "unique by id" free caches here.
-    /// But it's no obvious if we have many threads working with the single mwm.
+    LOG(LDEBUG, ("MwmValue max cache size reached! Added", id, "removed", m_cacheLru.front()));
+    TakeAllFromCacheImpl(*m_cacheLru.front().GetInfo(), evicted);
+  }
+  return true;
+}
 
-    m_cache.push_back(make_pair(id, std::move(p)));
-    if (m_cache.size() > m_cacheSize)
+void MwmSet::TakeAllFromCacheImpl(MwmInfo & info, vector<unique_ptr<MwmValue>> & values)
+{
+  for (auto & cachedValue : info.m_cachedValues)
+  {
+    if (MwmValue * value = cachedValue.exchange(nullptr))
     {
-      LOG(LDEBUG, ("MwmValue max cache size reached! Added", id, "removed", m_cache.front().first));
-      ASSERT_EQUAL(m_cache.size(), m_cacheSize + 1, ());
-      m_cache.pop_front();
+      --m_cachedValuesCount;
+      values.emplace_back(value);
     }
   }
+
+  auto const it = m_cacheLruIndex.find(&info);
+  if (it == m_cacheLruIndex.end())
+    return;
+
+  // The list holds the last reference to |info| after its deregistration.
+  auto const lruIt = it->second;
+  m_cacheLruIndex.erase(it);
+  m_cacheLru.erase(lruIt);
 }
 
 void MwmSet::Clear()
 {
   lock_guard<mutex> lock(m_lock);
-  ClearCacheImpl(m_cache.begin(), m_cache.end());
+  ClearCache();
   m_info.clear();
 }
 
 void MwmSet::ClearCache()
 {
-  lock_guard<mutex> lock(m_lock);
-  ClearCacheImpl(m_cache.begin(), m_cache.end());
+  vector<unique_ptr<MwmValue>> values;
+  lock_guard<mutex> lock(m_cacheLock);
+  while (!m_cacheLru.empty())
+    TakeAllFromCacheImpl(*m_cacheLru.front().GetInfo(), values);
 }
 
 MwmSet::MwmId MwmSet::GetMwmIdByCountryFile(CountryFile const & countryFile) const
@@ -366,53 +478,78 @@ MwmSet::MwmId MwmSet::GetMwmIdByCountryFile(CountryFile const & countryFile) con
 
 MwmSet::MwmHandle MwmSet::GetMwmHandleByCountryFile(CountryFile const & countryFile)
 {
-  MwmSet::MwmHandle handle;
-  WithEventLog([&](EventList & events)
-               {
-                 handle = GetMwmHandleByIdImpl(GetMwmIdByCountryFileImpl(countryFile), events);
-               });
-  return handle;
+  // The mwm is looked up and referenced at once, so it can't be replaced in between.
+  MwmId id;
+  bool locked;
+  {
+    lock_guard<mutex> lock(m_lock);
+    id = GetMwmIdByCountryFileImpl(countryFile);
+    locked = id.IsAlive() && AddRef(*id.GetInfo());
+  }
+  return MwmHandle(*this, id, locked ? TakeOrCreateValue(id) : nullptr);
 }
 
 MwmSet::MwmHandle MwmSet::GetMwmHandleById(MwmId const & id)
 {
-  MwmSet::MwmHandle handle;
-  WithEventLog([&](EventList & events)
-               {
-                 handle = GetMwmHandleByIdImpl(id, events);
-               });
-  return handle;
+  return MwmHandle(*this, id, LockValue(id));
 }
 
-MwmSet::MwmHandle MwmSet::GetMwmHandleByIdImpl(MwmId const & id, EventList & events)
+void MwmSet::ClearCache(MwmId const & id)
 {
-  unique_ptr<MwmValue> value;
-  if (id.IsAlive())
-    value = LockValueImpl(id, events);
-  return MwmHandle(*this, id, std::move(value));
+  vector<unique_ptr<MwmValue>> values;
+  lock_guard<mutex> lock(m_cacheLock);
+  TakeAllFromCacheImpl(*id.GetInfo(), values);
 }
 
-void MwmSet::ClearCacheImpl(Cache::iterator beg, Cache::iterator end) { m_cache.erase(beg, end); }
+// MwmValue ----------------------------------------------------------------------------------------
 
-void MwmSet::ClearCache(MwmId const & id)
+namespace
 {
-  auto sameId = [&id](pair<MwmSet::MwmId, unique_ptr<MwmValue>> const & p)
-  {
-    return (p.first == id);
-  };
-  ClearCacheImpl(base::RemoveIfKeepValid(m_cache.begin(), m_cache.end(), sameId), m_cache.end());
+// Bundled mwms may live inside an archive (e.g. apk) and can't be mapped directly.
+bool CanBeMapped(LocalCountryFile const & localFile) { return !localFile.IsInBundle(); }
+
+unique_ptr<ModelReader> CreateMwmReader(LocalCountryFile const & localFile, MwmValue::ReadMode mode)
+{
+  if (mode == MwmValue::ReadMode::Mapped && CanBeMapped(localFile))
+    return make_unique<MmapReader>(localFile.GetPath(MapFileType::Map));
+  return platform::GetCountryReader(localFile, MapFileType::Map);
 }
 
-// MwmValue ----------------------------------------------------------------------------------------
+// Sets access pattern hints for the mapped sections. The hot sections are accessed randomly
+// (by feature index, covering interval or trie node), so kernel read-ahead only pollutes
+// the page cache for them.
+void AdviseMappedSections(FilesContainerR const & cont)
+{
+  cont.ForEachTag([&cont](FilesContainerBase::Tag const & tag)
+  {
+    if (tag != FEATURES_FILE_TAG && tag != INDEX_FILE_TAG && tag != SEARCH_INDEX_FILE_TAG &&
+        !tag.starts_with(GEOMETRY_FILE_TAG) && !tag.starts_with(TRIANGLE_FILE_TAG))
+    {
+      return;
+    }
+
+    auto const reader = cont.GetReader(tag);
+    auto const * mmapReader = dynamic_cast<MmapReader const *>(reader.GetPtr());
+    CHECK(mmapReader, (tag));
+    mmapReader->Advise(0, mmapReader->Size(), MmapReader::Advice::Random);
+  });
+}
+}  // namespace
 
-MwmValue::MwmValue(LocalCountryFile const & localFile)
-  : m_cont(platform::GetCountryReader(localFile, MapFileType::Map)), m_file(localFile)
+MwmValue::MwmValue(LocalCountryFile const & localFile, ReadMode mode)
+  : m_cont(CreateMwmReader(localFile, mode))
+  , m_file(localFile)
+  , m_readMode(mode == ReadMode::Mapped && CanBeMapped(localFile) ? ReadMode::Mapped : ReadMode::Cached)
 {
   m_factory.Load(m_cont);
+
+  if (m_readMode == ReadMode::Mapped)
+    AdviseMappedSections(m_cont);
 }
 
 void MwmValue::SetTable(MwmInfoEx & info)
 {
+  lock_guard<mutex> lock(info.m_tableLock);
   m_table = info.m_table.lock();
   if (m_table)
     return;
@@ -421,6 +558,16 @@ void MwmValue::SetTable(MwmInfoEx & info)
   info.m_table = m_table;
 }
 
+string DebugPrint(MwmValue::ReadMode mode)
+{
+  switch (mode)
+  {
+  case MwmValue::ReadMode::Cached: return "Cached";
+  case MwmValue::ReadMode::Mapped: return "Mapped";
+  }
+  UNREACHABLE();
+}
+
 string DebugPrint(MwmSet::RegResult result)
 {
   switch (result)
@@ -12,17 +12,21 @@
 
 #include "defines.hpp"
 
+#include <array>
 #include <atomic>
-#include <deque>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace feature { class FeaturesOffsetsTable; }
 
+class MwmValue;
+
 /// Information about stored mwm.
 class MwmInfo
 {
@@ -45,7 +49,7 @@ public:
   };
 
   MwmInfo();
-  virtual ~MwmInfo() = default;
+  virtual ~MwmInfo();
 
   /// @obsolete Rect around region border. Features which cross region border may cross this rect.
   /// @todo VNG: Not true. This rect accumulates all features in MWM. Since we don't crop features by border,
@@ -74,7 +78,7 @@ public:
   feature::RegionData const & GetRegionData() const { return m_data; }
 
   /// Returns the lock counter value for test needs.
-  uint8_t GetNumRefs() const { return m_numRefs; }
+  uint32_t GetNumRefs() const { return m_numRefs & ~kDeregisteredRefs; }
 
 protected:
   Status SetStatus(Status status)
@@ -88,7 +92,17 @@ protected:
 
   platform::LocalCountryFile m_file;  ///< Path to the mwm file.
   std::atomic<Status> m_status;       ///< Current country status.
-  uint32_t m_numRefs;                 ///< Number of active handles.
+
+private:
+  /// Is set to |m_numRefs| when the mwm is deregistered, so no handles can be acquired after that.
+  static uint32_t constexpr kDeregisteredRefs = 1U << 31;
+  static size_t constexpr kMaxCachedValues = 4;
+
+  /// Number of active handles. Handles are acquired without MwmSet::m_lock.
+  std::atomic<uint32_t> m_numRefs;
+  /// Values of the released handles which are owned by MwmSet's cache. They are taken
+  /// and put back without MwmSet locks.
+  std::array<std::atomic<MwmValue *>, kMaxCachedValues> m_cachedValues;
 };
 
 class MwmInfoEx : public MwmInfo
@@ -102,14 +116,12 @@ private:
   // MwmSet's cache. We can't use shared_ptr because of offsets table
   // must be removed as soon as the last corresponding MwmValue is
   // destroyed. Also, note that this value must be used and modified
-  // only in MwmValue::SetTable() method, which, in turn, is called
-  // only in the MwmSet critical section, protected by a lock.  So,
-  // there's an implicit synchronization on this field.
+  // only in MwmValue::SetTable() method under |m_tableLock|, because
+  // values are created concurrently outside of the MwmSet critical section.
   std::weak_ptr<feature::FeaturesOffsetsTable> m_table;
+  std::mutex m_tableLock;
 };
 
-class MwmValue;
-
 class MwmSet
 {
 public:
@@ -139,7 +151,7 @@ public:
 
 public:
   explicit MwmSet(size_t cacheSize = 64) : m_cacheSize(cacheSize) {}
-  virtual ~MwmSet() = default;
+  virtual ~MwmSet();
 
   // Mwm handle, which is used to refer to mwm and prevent it from
   // deletion when its FileContainer is used.
@@ -256,6 +268,10 @@ public:
 protected:
   std::pair<MwmId, RegResult> RegisterImpl(platform::LocalCountryFile const & localFile,
                                            EventList & events);
+  /// Registers |info| which is already created from |localFile|.
+  std::pair<MwmId, RegResult> RegisterImpl(std::shared_ptr<MwmInfo> info,
+                                           platform::LocalCountryFile const & localFile,
+                                           EventList & events);
 
 public:
   std::pair<MwmId, RegResult> Register(platform::LocalCountryFile const & localFile);
@@ -311,11 +327,12 @@ public:
 
 protected:
   virtual std::unique_ptr<MwmInfo> CreateInfo(platform::LocalCountryFile const & localFile) const = 0;
-  virtual std::unique_ptr<MwmValue> CreateValue(MwmInfo & info) const = 0;
+  /// |localFile| is a copy of info.GetLocalFile() taken under the MwmSet lock, it should be used
+  /// instead of the info's one because the info may be updated concurrently.
+  virtual std::unique_ptr<MwmValue> CreateValue(MwmInfo & info,
+                                                platform::LocalCountryFile const & localFile) const = 0;
 
 private:
-  using Cache = std::deque<std::pair<MwmId, std::unique_ptr<MwmValue>>>;
-
   // This is the only valid way to take |m_lock| and use *Impl()
   // functions. The reason is that event processing requires
   // triggering of observers, but it's generally unsafe to call
@@ -340,23 +357,47 @@ private:
   // Triggers observers on each event in |events|.
   void ProcessEventList(EventList & events);
 
-  /// @precondition This function is always called under mutex m_lock.
-  MwmHandle GetMwmHandleByIdImpl(MwmId const & id, EventList & events);
-
+  /// Acquires a reference to the mwm and its cached value without locks. |m_lock| is only taken
+  /// to copy the mwm file when a new value is created.
   std::unique_ptr<MwmValue> LockValue(MwmId const & id);
-  std::unique_ptr<MwmValue> LockValueImpl(MwmId const & id, EventList & events);
+
+  /// Atomically increments number of active handles of the mwm unless it's deregistered.
+  static bool AddRef(MwmInfo & info);
+
+  /// Takes a value from the cache or creates a new one for the mwm referenced by AddRef().
+  /// The reference is released if the value can't be created. Note that a new value is
+  /// created without |m_lock| held, so CreateValue() overrides must be thread-safe.
+  std::unique_ptr<MwmValue> TakeOrCreateValue(MwmId const & id);
+
   void UnlockValue(MwmId const & id, std::unique_ptr<MwmValue> p);
-  void UnlockValueImpl(MwmId const & id, std::unique_ptr<MwmValue> p, EventList & events);
 
-  /// Do the cleaning for [beg, end) without acquiring the mutex.
-  /// @precondition This function is always called under mutex m_lock.
-  void ClearCacheImpl(Cache::iterator beg, Cache::iterator end);
+  /// Takes a cached value of the mwm without locks.
+  std::unique_ptr<MwmValue> TakeFromCache(MwmInfo & info);
+
+  /// Decrements number of active handles of the mwm and deregisters it if it's needed.
+  void ReleaseRef(MwmId const & id);
+
+  /// Puts |value| to the cache, it's left untouched if the cache of the mwm is full.
+  /// Values of the least recently released mwms are evicted to |evicted| when there are
+  /// more than |m_cacheSize| cached values.
+  bool PutToCache(MwmId const & id, std::unique_ptr<MwmValue> & value,
+                  std::vector<std::unique_ptr<MwmValue>> & evicted);
 
-  Cache m_cache;
+  /// Moves cached values of the mwm to |values| and removes the mwm from the LRU list.
+  /// @precondition This function is always called under mutex m_cacheLock.
+  void TakeAllFromCacheImpl(MwmInfo & info, std::vector<std::unique_ptr<MwmValue>> & values);
+
+  /// Cached values are stored in MwmInfo, the list is used to evict values of the least recently
+  /// released mwms when there are more than |m_cacheSize| values. The least recent mwm is at the front.
+  using CacheLru = std::list<MwmId>;
+  CacheLru m_cacheLru;
+  std::unordered_map<MwmInfo const *, CacheLru::iterator> m_cacheLruIndex;
+  std::atomic<size_t> m_cachedValuesCount{0};
   size_t const m_cacheSize;
+  /// Guards |m_cacheLru| and |m_cacheLruIndex|, |m_lock| is never taken under it.
+  std::mutex m_cacheLock;
 
 protected:
-  /// @precondition This function is always called under mutex m_lock.
   void ClearCache(MwmId const & id);
 
   /// Find mwm with a given name.
@@ -374,6 +415,16 @@ private:
 class MwmValue
 {
 public:
+  /// Defines how mwm sections are read.
+  enum class ReadMode
+  {
+    /// Sections are read through FileReader with its private page cache (ReaderCache).
+    Cached,
+    /// The whole file is memory mapped, so sections are read directly from the OS page cache,
+    /// which is shared between all readers and processes that have this mwm open.
+    Mapped
+  };
+
   FilesContainerR const m_cont;
   IndexFactory m_factory;
   platform::LocalCountryFile const m_file;
@@ -382,9 +433,11 @@ public:
   std::unique_ptr<indexer::MetadataDeserializer> m_metaDeserializer;
   std::unique_ptr<HouseToStreetTable> m_house2street, m_house2place;
 
-  explicit MwmValue(platform::LocalCountryFile const & localFile);
+  explicit MwmValue(platform::LocalCountryFile const & localFile, ReadMode mode = ReadMode::Cached);
   void SetTable(MwmInfoEx & info);
 
+  ReadMode GetReadMode() const { return m_readMode; }
+
   feature::DataHeader const & GetHeader() const  { return m_factory.GetHeader(); }
   feature::RegionData const & GetRegionData() const { return m_factory.GetRegionData(); }
   version::MwmVersion const & GetMwmVersion() const { return m_factory.GetMwmVersion(); }
@@ -392,8 +445,13 @@ public:
 
   bool HasSearchIndex() const { return m_cont.IsExist(SEARCH_INDEX_FILE_TAG); }
   bool HasGeometryIndex() const { return m_cont.IsExist(INDEX_FILE_TAG); }
+
+private:
+  ReadMode m_readMode;
 }; // class MwmValue
 
+std::string DebugPrint(MwmValue::ReadMode mode);
+
 
 std::string DebugPrint(MwmSet::RegResult result);
 std::string DebugPrint(MwmSet::Event::Type type);
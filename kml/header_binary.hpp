@@ -26,9 +26,13 @@ enum class Version : uint8_t
             // tags to kml
   V9 = 9,   // 01 October 2020: add minZoom to bookmarks
   Latest = V9,
-  V8MM = 10 // 27 July 2023: MapsMe release version v15.0.71617. Technically it's version is 8
-            // (first byte is 0x08), but it's not compatible with V8 from this repo. It has
-            // no compilations.
+  V8MM = 10, // 27 July 2023: MapsMe release version v15.0.71617. Technically it's version is 8
+             // (first byte is 0x08), but it's not compatible with V8 from this repo. It has
+             // no compilations.
+  V11 = 11,  // 18 October 2026: tracks geometry (all lines of multi geometry) is moved to
+             // the separate block-compressed section with limit rects of tracks. It's written
+             // on demand only (caches), Latest is kept for exported files to be readable by
+             // older versions. V10 is skipped because 10 is V8MM.
 };
 
 struct Header
@@ -41,9 +45,13 @@ struct Header
     visitor(m_tracksOffset, "tracksOffset");
     if (HasCompilationsSection())
       visitor(m_compilationsOffset, "compilationsOffset");
+    if (HasTracksGeometrySection())
+      visitor(m_tracksGeometryOffset, "tracksGeometryOffset");
     visitor(m_stringsOffset, "stringsOffset");
+    if (!HasTracksGeometrySection())
+      m_tracksGeometryOffset = m_stringsOffset;
     if (!HasCompilationsSection())
-      m_compilationsOffset = m_stringsOffset;
+      m_compilationsOffset = m_tracksGeometryOffset;
     visitor(m_eosOffset, "eosOffset");
   }
 
@@ -71,14 +79,17 @@ struct Header
 
   bool HasCompilationsSection() const
   {
-    return m_version == Version::V8 || m_version == Version::V9;
+    return m_version == Version::V8 || m_version == Version::V9 || m_version == Version::V11;
   }
 
+  bool HasTracksGeometrySection() const { return m_version == Version::V11; }
+
   Version m_version = Version::Latest;
   uint64_t m_categoryOffset = 0;
   uint64_t m_bookmarksOffset = 0;
   uint64_t m_tracksOffset = 0;
   uint64_t m_compilationsOffset = 0;
+  uint64_t m_tracksGeometryOffset = 0;
   uint64_t m_stringsOffset = 0;
   uint64_t m_eosOffset = 0;
 };
@@ -568,6 +568,35 @@ UNIT_TEST(Kml_Serialization_Bin_Memory)
   TEST_EQUAL(data, data2, ());
 }
 
+// 3.1. Check binary serialization with the separate tracks geometry section.
+UNIT_TEST(Kml_Serialization_Bin_V11_Memory)
+{
+  kml::FileData data = GenerateKmlFileData();
+  // All lines of multi geometry are stored.
+  data.m_tracksData.front().m_geometry.Assign({{{35.1964, 46.9832}, 1}, {{35.2244, 46.2786}, 2}});
+  // Limit rects of a track without geometry and a track in (0, 0) are different.
+  data.m_tracksData.push_back(data.m_tracksData.front());
+  data.m_tracksData.back().m_geometry.Clear();
+  data.m_tracksData.push_back(data.m_tracksData.front());
+  data.m_tracksData.back().m_geometry.Clear();
+  data.m_tracksData.back().m_geometry.Assign({{{0.0, 0.0}, 0}, {{0.0, 0.0}, 0}});
+
+  std::vector<uint8_t> buffer;
+  {
+    kml::binary::SerializerKml ser(data, kml::binary::Version::V11);
+    MemWriter<decltype(buffer)> sink(buffer);
+    ser.Serialize(sink);
+  }
+
+  kml::FileData data2;
+  {
+    kml::binary::DeserializerKml des(data2);
+    MemReader reader(buffer.data(), buffer.size());
+    des.Deserialize(reader);
+  }
+  TEST_EQUAL(data, data2, ());
+}
+
 // 4. Check deserialization from the text file.
 UNIT_TEST(Kml_Deserialization_Text_File)
 {
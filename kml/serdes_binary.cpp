@@ -4,9 +4,44 @@ namespace kml
 {
 namespace binary
 {
-SerializerKml::SerializerKml(FileData & data)
+namespace
+{
+std::vector<m2::RectD> ReadLimitRects(NonOwningReaderSource & source, uint8_t doubleBits)
+{
+  auto const count = ReadVarUint<uint32_t>(source);
+  std::vector<m2::RectD> rects;
+  rects.reserve(count);
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    if (ReadPrimitiveFromSource<uint8_t>(source) == 0)
+    {
+      // Track without geometry.
+      rects.emplace_back();
+      continue;
+    }
+    auto const leftBottom = ReadPointD(source, doubleBits);
+    auto const rightTop = ReadPointD(source, doubleBits);
+    rects.emplace_back(leftBottom, rightTop);
+  }
+  return rects;
+}
+
+MultiGeometry DeserializeGeometry(std::string const & buffer, uint8_t doubleBits)
+{
+  MemReader reader(buffer.data(), buffer.size());
+  NonOwningReaderSource source(reader);
+  BookmarkDeserializerVisitor<decltype(source)> visitor(source, doubleBits);
+  MultiGeometry geometry;
+  visitor(geometry.m_lines);
+  return geometry;
+}
+}  // namespace
+
+SerializerKml::SerializerKml(FileData & data, Version version)
   : m_data(data)
+  , m_version(version)
 {
+  CHECK(m_version == Version::Latest || m_version == Version::V11, (static_cast<int>(m_version)));
   ClearCollectionIndex();
 
   // Collect all strings and substitute each for index.
@@ -34,5 +69,19 @@ DeserializerKml::DeserializerKml(FileData & data)
 {
   m_data = {};
 }
+
+void DeserializerKml::DeserializeTracksGeometry(std::unique_ptr<Reader> & subReader, FileData & data)
+{
+  auto geometrySubReader = CreateTracksGeometrySubReader(*subReader);
+  NonOwningReaderSource src(*geometrySubReader);
+  auto const rects = ReadLimitRects(src, m_doubleBits);
+  if (rects.size() != data.m_tracksData.size())
+    MYTHROW(DeserializeException, ("Incorrect tracks count in geometry section:", rects.size()));
+
+  auto storageSubReader = geometrySubReader->CreateSubReader(src.Pos(), src.Size());
+  coding::BlockedTextStorage<Reader> storage(*storageSubReader);
+  for (size_t i = 0; i < data.m_tracksData.size(); ++i)
+    data.m_tracksData[i].m_geometry = DeserializeGeometry(storage.ExtractString(i), m_doubleBits);
+}
 }  // namespace binary
 }  // namespace kml
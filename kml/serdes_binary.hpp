@@ -12,20 +12,30 @@
 #include "platform/platform.hpp"
 
 #include "coding/read_write_utils.hpp"
+#include "coding/reader.hpp"
 #include "coding/sha1.hpp"
 #include "coding/text_storage.hpp"
+#include "coding/writer.hpp"
 
+#include "geometry/rect2d.hpp"
+
+#include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace kml
 {
 namespace binary
 {
+// Geometry of tracks is decompressed by blocks of about this size.
+uint64_t constexpr kTracksGeometryBlockSize = 64 * 1024;
+
 class SerializerKml
 {
 public:
-  explicit SerializerKml(FileData & data);
+  // Tracks geometry is stored in the separate section for Version::V11 only.
+  explicit SerializerKml(FileData & data, Version version = Version::Latest);
   ~SerializerKml();
 
   void ClearCollectionIndex();
@@ -34,7 +44,7 @@ public:
   void Serialize(Sink & sink)
   {
     // Write format version.
-    WriteToSink(sink, Version::Latest);
+    WriteToSink(sink, m_version);
 
     // Write device id.
     {
@@ -57,6 +67,7 @@ public:
 
     // Reserve place for the header.
     Header header;
+    header.m_version = m_version;
     WriteZeroesToSink(sink, header.Size());
 
     // Serialize category.
@@ -69,12 +80,19 @@ public:
 
     // Serialize tracks.
     header.m_tracksOffset = sink.Pos() - startPos;
-    SerializeTracks(sink);
+    SerializeTracks(sink, !header.HasTracksGeometrySection() /* writeGeometry */);
 
     // Serialize compilations.
     header.m_compilationsOffset = sink.Pos() - startPos;
     SerializeCompilations(sink);
 
+    // Serialize tracks geometry.
+    if (header.HasTracksGeometrySection())
+    {
+      header.m_tracksGeometryOffset = sink.Pos() - startPos;
+      SerializeTracksGeometry(sink);
+    }
+
     // Serialize strings.
     header.m_stringsOffset = sink.Pos() - startPos;
     SerializeStrings(sink);
@@ -101,12 +119,40 @@ public:
   }
 
   template <typename Sink>
-  void SerializeTracks(Sink & sink)
+  void SerializeTracks(Sink & sink, bool writeGeometry = true)
   {
-    BookmarkSerializerVisitor<Sink> visitor(sink, kDoubleBits);
+    BookmarkSerializerVisitor<Sink> visitor(sink, kDoubleBits, writeGeometry);
     visitor(m_data.m_tracksData);
   }
 
+  // Serializes limit rects of tracks and their geometry in a compressed storage with block access.
+  template <typename Sink>
+  void SerializeTracksGeometry(Sink & sink)
+  {
+    WriteVarUint(sink, static_cast<uint32_t>(m_data.m_tracksData.size()));
+    for (auto const & trackData : m_data.m_tracksData)
+    {
+      // A zero rect is a valid rect of a track in (0, 0), so empty geometry is flagged explicitly.
+      auto const rect = trackData.m_geometry.GetLimitRect();
+      WriteToSink(sink, static_cast<uint8_t>(rect.IsValid() ? 1 : 0));
+      if (!rect.IsValid())
+        continue;
+      WritePointD(sink, rect.LeftBottom(), kDoubleBits);
+      WritePointD(sink, rect.RightTop(), kDoubleBits);
+    }
+
+    coding::BlockedTextStorageWriter<Sink> writer(sink, kTracksGeometryBlockSize);
+    std::string buffer;
+    for (auto const & trackData : m_data.m_tracksData)
+    {
+      buffer.clear();
+      MemWriter<std::string> geometrySink(buffer);
+      BookmarkSerializerVisitor<decltype(geometrySink)> visitor(geometrySink, kDoubleBits);
+      visitor(trackData.m_geometry.m_lines);
+      writer.Append(buffer);
+    }
+  }
+
   template <typename Sink>
   void SerializeCompilations(Sink & sink)
   {
@@ -125,6 +171,7 @@ public:
 
 protected:
   FileData & m_data;
+  Version const m_version;
   std::vector<std::string> m_strings;
 };
 
@@ -156,7 +203,8 @@ public:
     if (m_header.m_version != Version::V2 && m_header.m_version != Version::V3 &&
         m_header.m_version != Version::V4 && m_header.m_version != Version::V5 &&
         m_header.m_version != Version::V6 && m_header.m_version != Version::V7 &&
-        m_header.m_version != Version::V8 && m_header.m_version != Version::V9)
+        m_header.m_version != Version::V8 && m_header.m_version != Version::V9 &&
+        m_header.m_version != Version::V11)
     {
       MYTHROW(DeserializeException, ("Incorrect file version."));
     }
@@ -170,6 +218,7 @@ public:
 
     switch (m_header.m_version)
     {
+    case Version::V11:
     case Version::Latest:
     {
       DeserializeFileData(subReader, m_data);
@@ -264,6 +313,7 @@ private:
         m_header.m_version = Version::V8MM;
         m_header.m_eosOffset = m_header.m_stringsOffset;
         m_header.m_stringsOffset = m_header.m_compilationsOffset;
+        m_header.m_tracksGeometryOffset = m_header.m_stringsOffset;
       }
     }
     m_initialized = true;
@@ -300,7 +350,13 @@ private:
   template <typename ReaderType>
   std::unique_ptr<Reader> CreateCompilationsSubReader(ReaderType const & reader)
   {
-    return CreateSubReader(reader, m_header.m_compilationsOffset, m_header.m_stringsOffset);
+    return CreateSubReader(reader, m_header.m_compilationsOffset, m_header.m_tracksGeometryOffset);
+  }
+
+  template <typename ReaderType>
+  std::unique_ptr<Reader> CreateTracksGeometrySubReader(ReaderType const & reader)
+  {
+    return CreateSubReader(reader, m_header.m_tracksGeometryOffset, m_header.m_stringsOffset);
   }
 
   template <typename ReaderType>
@@ -341,6 +397,11 @@ private:
     DeserializeTracks(subReader, data);
     if constexpr (HasCompilationsData<FileDataType>::value)
       DeserializeCompilations(subReader, data);
+    if constexpr (std::is_same_v<FileDataType, FileData>)
+    {
+      if (m_header.HasTracksGeometrySection())
+        DeserializeTracksGeometry(subReader, data);
+    }
     DeserializeStrings(subReader, data);
   }
 
@@ -373,10 +434,13 @@ private:
   {
     auto trackSubReader = CreateTrackSubReader(*subReader);
     NonOwningReaderSource src(*trackSubReader);
-    BookmarkDeserializerVisitor<decltype(src)> visitor(src, m_doubleBits);
+    BookmarkDeserializerVisitor<decltype(src)> visitor(src, m_doubleBits,
+                                                       !m_header.HasTracksGeometrySection() /* readGeometry */);
     visitor(data.m_tracksData);
   }
 
+  void DeserializeTracksGeometry(std::unique_ptr<Reader> & subReader, FileData & data);
+
   template <typename FileDataType>
   void DeserializeCompilations(std::unique_ptr<Reader> & subReader, FileDataType & data)
   {
@@ -38,4 +38,15 @@ void MultiGeometry::FromPoints(std::vector<m2::PointD> const & points)
   ASSERT(line.size() > 1, ());
   m_lines.push_back(std::move(line));
 }
+
+m2::RectD MultiGeometry::GetLimitRect() const
+{
+  m2::RectD rect;
+  for (auto const & line : m_lines)
+  {
+    for (auto const & pt : line)
+      rect.Add(pt.GetPoint());
+  }
+  return rect;
+}
 }  // namespace kml
@@ -4,6 +4,8 @@
 
 #include "coding/point_coding.hpp"
 
+#include "geometry/rect2d.hpp"
+
 #include "base/assert.hpp"
 #include "base/internal/message.hpp"  // DebugPrint(Timestamp)
 #include "base/visitor.hpp"
@@ -326,6 +328,7 @@ struct MultiGeometry
   }
 
   void FromPoints(std::vector<m2::PointD> const & points);
+  m2::RectD GetLimitRect() const;
   void Assign(std::initializer_list<geometry::PointWithAltitude> lst)
   {
     m_lines.emplace_back();
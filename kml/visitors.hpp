@@ -347,9 +347,11 @@ template <typename Sink>
 class BookmarkSerializerVisitor
 {
 public:
-  explicit BookmarkSerializerVisitor(Sink & sink, uint8_t doubleBits)
+  // Tracks geometry is not written if |writeGeometry| is false, it's stored in the separate section.
+  explicit BookmarkSerializerVisitor(Sink & sink, uint8_t doubleBits, bool writeGeometry = true)
     : m_sink(sink)
     , m_doubleBits(doubleBits)
+    , m_writeGeometry(writeGeometry)
   {}
 
   void operator()(LocalizableStringIndex const & index, char const * /* name */ = nullptr)
@@ -438,6 +440,9 @@ public:
 
   void operator()(MultiGeometry const & geom, char const * /* name */ = nullptr)
   {
+    if (!m_writeGeometry)
+      return;
+
     /// @todo Update version if we want to save multi geometry into binary.
     CHECK(!geom.m_lines.empty(), ());
     (*this)(geom.m_lines[0]);
@@ -466,6 +471,7 @@ public:
 private:
   Sink & m_sink;
   uint8_t const m_doubleBits;
+  bool const m_writeGeometry;
 };
 
 template <typename Source>
@@ -568,9 +574,11 @@ template <typename Source>
 class BookmarkDeserializerVisitor
 {
 public:
-  explicit BookmarkDeserializerVisitor(Source & source, uint8_t doubleBits)
+  // Tracks geometry is not read if |readGeometry| is false, it's stored in the separate section.
+  explicit BookmarkDeserializerVisitor(Source & source, uint8_t doubleBits, bool readGeometry = true)
     : m_source(source)
     , m_doubleBits(doubleBits)
+    , m_readGeometry(readGeometry)
   {}
 
   void operator()(LocalizableStringIndex & index, char const * /* name */ = nullptr)
@@ -670,6 +678,9 @@ public:
 
   void operator()(MultiGeometry & geom, char const * /* name */ = nullptr)
   {
+    if (!m_readGeometry)
+      return;
+
     /// @todo Update version if we want to save multi geometry into binary.
     MultiGeometry::LineT line;
     (*this)(line);
@@ -699,6 +710,7 @@ public:
 private:
   Source & m_source;
   uint8_t const m_doubleBits;
+  bool const m_readGeometry;
 };
 
 template <typename Reader>
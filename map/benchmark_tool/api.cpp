@@ -53,4 +53,33 @@ void AllResult::Print()
             " summ:" << m_all << " ]" << endl;
   }
 }
+
+void TilesResult::Print()
+{
+  if (m_tiles == 0)
+  {
+    cout << "No tiles" << endl;
+    return;
+  }
+
+  cout << fixed << setprecision(3);
+  size_t const count = 1000;
+  auto const printStage = [count](char const * name, Result & r)
+  {
+    r.CalcMetrics();
+    cout << name << "*1000[ median:" << r.m_med * count << " avg:" << r.m_avg * count
+         << " max:" << r.m_max * count << " total:" << r.m_all << " ]" << endl;
+  };
+
+  cout << "Tiles: " << m_tiles << endl;
+  printStage("INDEX", m_index);
+  printStage("READING", m_reading);
+  printStage("STYLING", m_styling);
+  printStage("SHAPES", m_shapes);
+
+  double const tiles = static_cast<double>(m_tiles);
+  cout << "PER TILE[ features:" << m_features / tiles << " geometry shapes:" << m_geometryShapes / tiles
+       << " overlays:" << m_overlays / tiles << " vertices:" << m_vertices / tiles
+       << " allocations:" << m_allocations / tiles << " ]" << endl;
+}
 }  // namespace bench
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <utility>
 #include <vector>
@@ -43,6 +45,32 @@ namespace bench
     double m_all = 0.0;
   };
 
+  /// Per-stage timings and per-tile counters of the CPU side of the tiles generation.
+  class TilesResult
+  {
+  public:
+    void Print();
+
+    Result m_index;
+    Result m_reading;
+    Result m_styling;
+    Result m_shapes;
+
+    size_t m_tiles = 0;
+    size_t m_features = 0;
+    size_t m_geometryShapes = 0;
+    size_t m_overlays = 0;
+    size_t m_vertices = 0;
+    uint64_t m_allocations = 0;
+  };
+
   /// @param[in] count number of times to run benchmark
   void RunFeaturesLoadingBenchmark(std::string filePath, std::pair<int, int> scaleR, AllResult & res);
+
+  /// Replays tiles from |tilesFile| (lines of "x y zoom") or, if it's empty, at most |maxTilesPerZoom|
+  /// tiles around the mwm center for each zoom of |scaleR| through the drape_frontend tile reading
+  /// pipeline without GPU: features index, features reading, styling and map shapes generation.
+  void RunTilesGenerationBenchmark(std::string filePath, std::pair<int, int> scaleR,
+                                   std::string const & tilesFile, size_t maxTilesPerZoom,
+                                   TilesResult & res);
 }  // namespace bench
@@ -13,6 +13,11 @@ DEFINE_string(input, "", "MWM file name in the data directory");
 DEFINE_int32(lowS, 10, "Low processing scale");
 DEFINE_int32(highS, 17, "High processing scale");
 DEFINE_bool(print_scales, false, "Print geometry scales for MWM and exit");
+DEFINE_bool(tiles, false, "Benchmark tiles generation (drape_frontend backend without GPU) instead of "
+                          "features loading");
+DEFINE_string(tiles_file, "", "File with tiles to replay, one \"x y zoom\" per line. If empty, "
+                              "tiles around the MWM center for each processing scale are used");
+DEFINE_uint64(max_tiles, 16, "Max number of generated tiles per scale");
 
 int main(int argc, char ** argv)
 {
@@ -37,6 +42,15 @@ int main(int argc, char ** argv)
     return 0;
   }
 
+  if (!FLAGS_input.empty() && FLAGS_tiles)
+  {
+    bench::TilesResult res;
+    bench::RunTilesGenerationBenchmark(FLAGS_input, make_pair(FLAGS_lowS, FLAGS_highS),
+                                       FLAGS_tiles_file, FLAGS_max_tiles, res);
+    res.Print();
+    return 0;
+  }
+
   if (!FLAGS_input.empty())
   {
     using namespace bench;
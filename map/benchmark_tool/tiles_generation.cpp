@@ -0,0 +1,272 @@
+#include "map/benchmark_tool/api.hpp"
+
+#include "map/features_fetcher.hpp"
+
+#include "drape_frontend/apply_feature_functors.hpp"
+#include "drape_frontend/map_shape.hpp"
+#include "drape_frontend/stylist.hpp"
+#include "drape_frontend/tile_key.hpp"
+#include "drape_frontend/tile_utils.hpp"
+#include "drape_frontend/visual_params.hpp"
+
+#include "indexer/feature.hpp"
+#include "indexer/feature_algo.hpp"
+
+#include "platform/preferred_languages.hpp"
+
+#include "geometry/screenbase.hpp"
+
+#include "base/file_name_utils.hpp"
+#include "base/logging.hpp"
+#include "base/timer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+// Heap allocations are counted by the replaced global operator new.
+atomic<uint64_t> g_allocations{0};
+}  // namespace
+
+void * operator new(size_t size)
+{
+  ++g_allocations;
+  if (void * p = malloc(size == 0 ? 1 : size))
+    return p;
+  throw bad_alloc();
+}
+
+void operator delete(void * p) noexcept { free(p); }
+void operator delete(void * p, size_t) noexcept { free(p); }
+
+namespace bench
+{
+namespace
+{
+class TileProcessor
+{
+public:
+  TileProcessor(df::TileKey const & tileKey, int8_t deviceLang, TilesResult & res)
+    : m_tileKey(tileKey)
+    , m_globalRect(tileKey.GetGlobalRect())
+    , m_zoomLevel(tileKey.m_zoomLevel)
+    , m_deviceLang(deviceLang)
+    , m_res(res)
+  {
+    // The same scale as in df::RuleDrawer.
+    auto const tileSize = static_cast<int>(df::VisualParams::Instance().GetTileSize());
+    ScreenBase geometryConvertor;
+    geometryConvertor.OnSize(0, 0, tileSize, tileSize);
+    geometryConvertor.SetFromRect(m2::AnyRectD(tileKey.GetGlobalRect(false /* clipByDataMaxZoom */)));
+    m_currentScaleGtoP = 1.0 / geometryConvertor.GetScale();
+  }
+
+  void operator()(FeatureType & f)
+  {
+    ++m_res.m_features;
+
+    m_timer.Reset();
+    df::Stylist const s(f, m_zoomLevel, m_deviceLang);
+    m_stylingTime += m_timer.ElapsedSeconds();
+
+    if (!s.m_symbolRule && !s.m_captionRule && !s.m_houseNumberRule &&
+        s.m_lineRules.empty() && !s.m_areaRule && !s.m_hatchingRule)
+    {
+      return;
+    }
+
+    m_timer.Reset();
+    // FeatureType::GetLimitRect call invokes full geometry reading and decoding.
+    if (m_globalRect.IsIntersect(f.GetLimitRect(m_zoomLevel)))
+    {
+      auto const geomType = f.GetGeomType();
+      if (geomType == feature::GeomType::Area)
+        ProcessArea(f, s);
+      else if (!s.m_lineRules.empty())
+        ProcessLine(f, s);
+      else
+        CountPointOverlays(s);
+    }
+    m_shapesTime += m_timer.ElapsedSeconds();
+  }
+
+  double GetStylingTime() const { return m_stylingTime; }
+  double GetShapesTime() const { return m_shapesTime; }
+
+private:
+  void InsertShape(drape_ptr<df::MapShape> && shape)
+  {
+    // Overlays can't be laid out without textures (glyphs and symbols), so only
+    // geometry shapes are generated and overlays are counted by drawing rules.
+    if (shape->GetType() == df::GeometryType)
+      ++m_res.m_geometryShapes;
+  }
+
+  void ProcessArea(FeatureType & f, df::Stylist const & s)
+  {
+    auto const insertShape = [this](drape_ptr<df::MapShape> && shape) { InsertShape(std::move(shape)); };
+    df::ApplyAreaFeature apply(m_tileKey, insertShape, f, m_currentScaleGtoP, false /* isBuilding */,
+                               0.0f /* minPosZ */, 0.0f /* posZ */, s.GetCaptionDescription());
+    if (s.m_areaRule || s.m_hatchingRule)
+    {
+      f.ForEachTriangle([&](m2::PointD const & p1, m2::PointD const & p2, m2::PointD const & p3)
+      {
+        m_res.m_vertices += 3;
+        apply(p1, p2, p3);
+      }, m_zoomLevel);
+
+      if (apply.HasGeometry())
+        apply.ProcessAreaRules(s.m_areaRule, s.m_hatchingRule);
+    }
+
+    if (m_globalRect.IsPointInside(feature::GetCenter(f, m_zoomLevel)))
+      CountPointOverlays(s);
+  }
+
+  void ProcessLine(FeatureType & f, df::Stylist const & s)
+  {
+    auto const insertShape = [this](drape_ptr<df::MapShape> && shape) { InsertShape(std::move(shape)); };
+    df::ApplyLineFeatureGeometry apply(m_tileKey, insertShape, f, m_currentScaleGtoP);
+    f.ForEachPoint([&](m2::PointD const & pt)
+    {
+      ++m_res.m_vertices;
+      apply(pt);
+    }, m_zoomLevel);
+
+    if (!apply.HasGeometry())
+      return;
+
+    apply.ProcessLineRules(s.m_lineRules);
+
+    size_t const splinesCount = apply.GetClippedSplines().size();
+    if (s.m_pathtextRule)
+      m_res.m_overlays += splinesCount;
+    if (s.m_shieldRule)
+      m_res.m_overlays += s.m_roadShields.size();
+  }
+
+  void CountPointOverlays(df::Stylist const & s)
+  {
+    if (s.m_symbolRule)
+      ++m_res.m_overlays;
+    if (s.m_captionRule && s.GetCaptionDescription().IsNameExists())
+      ++m_res.m_overlays;
+    if (s.m_houseNumberRule && s.GetCaptionDescription().IsHouseNumberExists())
+      ++m_res.m_overlays;
+  }
+
+  df::TileKey const m_tileKey;
+  m2::RectD const m_globalRect;
+  uint8_t const m_zoomLevel;
+  int8_t const m_deviceLang;
+  double m_currentScaleGtoP = 1.0;
+
+  base::Timer m_timer;
+  double m_stylingTime = 0.0;
+  double m_shapesTime = 0.0;
+
+  TilesResult & m_res;
+};
+
+vector<df::TileKey> LoadTiles(string const & tilesFile)
+{
+  vector<df::TileKey> tiles;
+  ifstream stream(tilesFile);
+  int x, y, zoom;
+  while (stream >> x >> y >> zoom)
+    tiles.emplace_back(x, y, static_cast<uint8_t>(zoom));
+
+  if (tiles.empty())
+    LOG(LWARNING, ("No tiles were read from", tilesFile));
+  return tiles;
+}
+
+vector<df::TileKey> GenerateTiles(m2::RectD const & rect, pair<int, int> const & scaleRange,
+                                  size_t maxTilesPerZoom)
+{
+  vector<df::TileKey> tiles;
+  auto const center = rect.Center();
+  for (int zoom = scaleRange.first; zoom <= scaleRange.second; ++zoom)
+  {
+    vector<df::TileKey> zoomTiles;
+    df::CalcTilesCoverage(rect, zoom, [&](int x, int y)
+    {
+      zoomTiles.emplace_back(x, y, static_cast<uint8_t>(zoom));
+    });
+
+    // Tiles near the center are the most dense ones usually (city center).
+    auto const distance = [&center](df::TileKey const & key)
+    {
+      return key.GetGlobalRect(false /* clipByDataMaxZoom */).Center().SquaredLength(center);
+    };
+    size_t const count = min(maxTilesPerZoom, zoomTiles.size());
+    partial_sort(zoomTiles.begin(), zoomTiles.begin() + count, zoomTiles.end(),
+                 [&distance](df::TileKey const & lhs, df::TileKey const & rhs)
+    {
+      return distance(lhs) < distance(rhs);
+    });
+    tiles.insert(tiles.end(), zoomTiles.begin(), zoomTiles.begin() + count);
+  }
+  return tiles;
+}
+
+void RunBenchmark(FeaturesFetcher const & src, vector<df::TileKey> const & tiles, TilesResult & res)
+{
+  auto const deviceLang = StringUtf8Multilang::GetLangIndex(languages::GetCurrentNorm());
+
+  vector<FeatureID> ids;
+  for (auto const & tileKey : tiles)
+  {
+    g_allocations = 0;
+    ids.clear();
+
+    // The same as df::TileInfo::ReadFeatureIndex.
+    base::Timer timer;
+    src.ForEachFeatureID(tileKey.GetGlobalRect(), [&ids](FeatureID const & id) { ids.push_back(id); },
+                         df::ClipTileZoomByMaxDataZoom(tileKey.m_zoomLevel));
+    sort(ids.begin(), ids.end());
+    res.m_index.Add(timer.ElapsedSeconds());
+
+    TileProcessor processor(tileKey, deviceLang, res);
+    timer.Reset();
+    src.ReadFeatures(processor, ids);
+    double const readingTime = timer.ElapsedSeconds();
+
+    res.m_styling.Add(processor.GetStylingTime());
+    res.m_shapes.Add(processor.GetShapesTime());
+    res.m_reading.Add(readingTime - processor.GetStylingTime() - processor.GetShapesTime());
+
+    res.m_allocations += g_allocations;
+    ++res.m_tiles;
+  }
+}
+}  // namespace
+
+void RunTilesGenerationBenchmark(string fileName, pair<int, int> scaleRange, string const & tilesFile,
+                                 size_t maxTilesPerZoom, TilesResult & res)
+{
+  base::GetNameFromFullPath(fileName);
+  base::GetNameWithoutExt(fileName);
+
+  FeaturesFetcher src;
+  auto const r = src.RegisterMap(platform::LocalCountryFile::MakeForTesting(std::move(fileName)));
+  if (r.second != MwmSet::RegResult::Success)
+    return;
+
+  // Drawing rules are loaded with classificator.
+  df::VisualParams::Init(df::VisualParams::kXhdpiScale, 512 /* tileSize */);
+
+  auto const tiles = tilesFile.empty()
+                         ? GenerateTiles(r.first.GetInfo()->m_bordersRect, scaleRange, maxTilesPerZoom)
+                         : LoadTiles(tilesFile);
+  RunBenchmark(src, tiles, res);
+}
+}  // namespace bench
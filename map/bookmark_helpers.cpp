@@ -15,7 +15,9 @@
 
 #include "coding/file_reader.hpp"
 #include "coding/file_writer.hpp"
+#include "coding/hex.hpp"
 #include "coding/internal/file_data.hpp"
+#include "coding/sha1.hpp"
 #include "coding/zip_reader.hpp"
 
 #include "base/file_name_utils.hpp"
@@ -225,6 +227,11 @@ std::string GetBookmarksDirectory()
   return base::JoinPath(GetPlatform().SettingsDir(), "bookmarks");
 }
 
+std::string GetBookmarksCacheDirectory()
+{
+  return base::JoinPath(GetPlatform().SettingsDir(), "bookmarks_cache");
+}
+
 std::string RemoveInvalidSymbols(std::string const & name)
 {
   strings::UniString filtered;
@@ -345,6 +352,70 @@ std::unique_ptr<kml::FileData> LoadKmlFile(std::string const & file, KmlFileType
   return kmlData;
 }
 
+std::string GetKmbCachePath(std::string const & file, std::string const & cacheDir)
+{
+  if (!Platform::IsFileExistsByFullPath(file))
+    return {};
+
+  // Modification time has a one second precision on some platforms, so an edit of the same size
+  // within a second is not noticed by it. Hashing is much faster than parsing anyway.
+  std::ostringstream name;
+  name << base::GetNameFromFullPathWithoutExt(file) << '.' << ToHex(coding::SHA1::Calculate(file)) << kKmbExtension;
+  return base::JoinPath(cacheDir, name.str());
+}
+
+namespace
+{
+// The cache must be lossless: the binary versions before V11 keep the first line of multi geometry tracks only.
+auto constexpr kKmbCacheVersion = kml::binary::Version::V11;
+
+bool SaveKmbCacheFile(kml::FileData & kmlData, std::string const & cachePath)
+{
+  return base::WriteToTempAndRenameToFile(cachePath, [&kmlData](std::string const & fileName)
+  {
+    try
+    {
+      FileWriter writer(fileName);
+      kml::binary::SerializerKml ser(kmlData, kKmbCacheVersion);
+      ser.Serialize(writer);
+    }
+    catch (std::exception const & e)
+    {
+      LOG(LWARNING, ("KMB cache writing failure:", e.what()));
+      return false;
+    }
+    return true;
+  });
+}
+}  // namespace
+
+std::unique_ptr<kml::FileData> LoadKmlFileCached(std::string const & file, KmlFileType fileType,
+                                                 std::string const & cachePath)
+{
+  if (cachePath.empty())
+    return LoadKmlFile(file, fileType);
+
+  if (Platform::IsFileExistsByFullPath(cachePath))
+  {
+    try
+    {
+      // Names were filled before saving of the copy, so FillEmptyNames() is not needed.
+      if (auto kmlData = LoadKmlData(FileReader(cachePath), KmlFileType::Binary))
+        return kmlData;
+    }
+    catch (std::exception const & e)
+    {
+      LOG(LWARNING, ("KMB cache loading failure:", e.what()));
+    }
+    base::DeleteFileX(cachePath);
+  }
+
+  auto kmlData = LoadKmlFile(file, fileType);
+  if (kmlData != nullptr && !SaveKmbCacheFile(*kmlData, cachePath))
+    base::DeleteFileX(cachePath);
+  return kmlData;
+}
+
 std::vector<std::string> GetKMLOrGPXFilesPathsToLoad(std::string const & filePath)
 {
   std::string const fileExt = GetLowercaseFileExt(filePath);
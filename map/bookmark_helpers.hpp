@@ -92,6 +92,7 @@ inline std::string DebugPrint(KmlFileType fileType)
 /// @name File name/path helpers.
 /// @{
 std::string GetBookmarksDirectory();
+std::string GetBookmarksCacheDirectory();
 std::string RemoveInvalidSymbols(std::string const & name);
 std::string GenerateUniqueFileName(const std::string & path, std::string name, std::string_view ext = kKmlExtension);
 std::string GenerateValidAndUniqueFilePathForKML(std::string const & fileName);
@@ -103,6 +104,15 @@ std::string GenerateValidAndUniqueFilePathForGPX(std::string const & fileName);
 std::unique_ptr<kml::FileData> LoadKmlFile(std::string const & file, KmlFileType fileType);
 std::unique_ptr<kml::FileData> LoadKmlData(Reader const & reader, KmlFileType fileType);
 
+/// Parsed text files are copied in the binary format to the cache directory to skip parsing
+/// on next loads. The copy name contains the hash of the file content, so the copy is used
+/// until the file is changed.
+/// \returns Empty string if the file doesn't exist.
+std::string GetKmbCachePath(std::string const & file, std::string const & cacheDir);
+/// Loads the file from |cachePath| if the copy exists, otherwise parses the file and saves the copy.
+std::unique_ptr<kml::FileData> LoadKmlFileCached(std::string const & file, KmlFileType fileType,
+                                                 std::string const & cachePath);
+
 std::vector<std::string> GetKMLOrGPXFilesPathsToLoad(std::string const & filePath);
 std::vector<std::string> GetFilePathsToLoadFromKml(std::string const & filePath);
 std::vector<std::string> GetFilePathsToLoadFromGpx(std::string const & filePath);
@@ -26,13 +26,17 @@
 #include "base/macros.hpp"
 #include "base/stl_helpers.hpp"
 #include "base/string_utils.hpp"
+#include "base/thread_pool_computational.hpp"
 
 #include <algorithm>
 #include <chrono>
+#include <future>
 #include <iomanip>
 #include <limits>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace
 {
@@ -44,6 +48,9 @@ std::string const kLargestBookmarkSymbolName = "bookmark-default-m";
 size_t const kMinCommonTypesCount = 3;
 double const kNearDistanceInMeters = 20 * 1000.0;
 double const kMyPositionTrackSnapInMeters = 20.0;
+size_t const kMaxLoadingThreadsCount = 4;
+// Loaded files are passed to the UI by batches of about this number of bookmarks and tracks.
+size_t const kLoadingBatchItemsCount = 1000;
 
 std::string const kKMLMimeType = "application/vnd.google-earth.kml";
 std::string const kKMZMimeType = "application/vnd.google-earth.kmz";
@@ -394,6 +401,7 @@ void BookmarkManager::DeleteBookmark(kml::MarkId bmId)
 
   DetachUserMark(bmId, groupId);
   m_changesTracker.OnDeleteMark(bmId);
+  m_spatialIndex.EraseBookmark(bmId, it->second->GetPivot());
 
   m_recentlyDeletedBookmark = std::move(it->second);
   m_bookmarks.erase(it);
@@ -481,6 +489,7 @@ void BookmarkManager::DeleteTrack(kml::TrackId trackId)
   if (groupId != kml::kInvalidMarkGroupId)
     GetBmCategory(groupId)->DetachTrack(trackId);
   m_changesTracker.OnDeleteLine(trackId);
+  m_spatialIndex.EraseTrack(trackId, it->second->GetLimitRect());
   m_tracks.erase(it);
 }
 
@@ -873,21 +882,18 @@ Track::TrackSelectionInfo BookmarkManager::FindNearestTrack(
   CHECK_THREAD_CHECKER(m_threadChecker, ());
   Track::TrackSelectionInfo selectionInfo;
 
-  for (auto const & pair : m_categories)
+  m_spatialIndex.ForEachTrackInRect(touchRect, [&](kml::TrackId trackId)
   {
-    auto const & category = *pair.second;
-    if (!category.IsVisible())
-      continue;
+    auto const track = GetTrack(trackId);
+    auto const groupId = track->GetGroupId();
+    if (groupId == kml::kInvalidMarkGroupId || !GetBmCategory(groupId)->IsVisible())
+      return;
 
-    for (auto trackId : category.GetUserLines())
-    {
-      auto const track = GetTrack(trackId);
-      if (!track->IsInteractive() || (tracksFilter && !tracksFilter(track)))
-        continue;
+    if (!track->IsInteractive() || (tracksFilter && !tracksFilter(track)))
+      return;
 
-      track->UpdateSelectionInfo(touchRect, selectionInfo);
-    }
-  }
+    track->UpdateSelectionInfo(touchRect, selectionInfo);
+  });
 
   return selectionInfo;
 }
@@ -1532,6 +1538,7 @@ void BookmarkManager::ClearGroup(kml::MarkGroupId groupId)
     if (IsBookmarkCategory(groupId))
     {
       m_changesTracker.OnDetachBookmark(markId, groupId);
+      m_spatialIndex.EraseBookmark(markId, GetBookmark(markId)->GetPivot());
       m_bookmarks.erase(markId);
     }
     else
@@ -1544,6 +1551,7 @@ void BookmarkManager::ClearGroup(kml::MarkGroupId groupId)
   {
     DeleteTrackSelectionMark(trackId);
     m_changesTracker.OnDeleteLine(trackId);
+    m_spatialIndex.EraseTrack(trackId, GetTrack(trackId)->GetLimitRect());
     m_tracks.erase(trackId);
   }
   group->Clear();
@@ -1671,6 +1679,38 @@ UserMark const * BookmarkManager::FindMarkInRect(kml::MarkGroupId groupId, m2::A
   return resMark;
 }
 
+UserMark const * BookmarkManager::FindBookmarkInRect(m2::AnyRectD const & rect, bool findOnlyVisible,
+                                                     double & d) const
+{
+  CHECK_THREAD_CHECKER(m_threadChecker, ());
+
+  UserMark const * resMark = nullptr;
+  auto const globalCenter = rect.GlobalCenter();
+  m_spatialIndex.ForEachBookmarkInRect(rect.GetGlobalRect(), [&](kml::MarkId markId)
+  {
+    auto const * bookmark = GetBookmark(markId);
+    auto const groupId = bookmark->GetGroupId();
+    if (groupId == kml::kInvalidMarkGroupId || !GetBmCategory(groupId)->IsVisible())
+      return;
+
+    if (findOnlyVisible && !bookmark->IsVisible())
+      return;
+
+    auto const & pivot = bookmark->GetPivot();
+    if (!bookmark->IsAvailableForSearch() || !rect.IsPointInside(pivot))
+      return;
+
+    // The index has no order, so the lastly added one is preferred among bookmarks at the same point.
+    double const dist = globalCenter.SquaredLength(pivot);
+    if (dist < d || (dist == d && resMark != nullptr && markId > resMark->GetId()))
+    {
+      resMark = bookmark;
+      d = dist;
+    }
+  });
+  return resMark;
+}
+
 void BookmarkManager::SetIsVisible(kml::MarkGroupId groupId, bool visible)
 {
   CHECK_THREAD_CHECKER(m_threadChecker, ());
@@ -1765,10 +1805,11 @@ void BookmarkManager::SetDrapeEngine(ref_ptr<df::DrapeEngine> engine)
 }
 
 void BookmarkManager::InitRegionAddressGetter(DataSource const & dataSource,
-                                              storage::CountryInfoGetter const & infoGetter)
+                                              storage::CountryInfoGetter const & infoGetter,
+                                              FeatureAttributesCache * attributesCache)
 {
   std::unique_lock const lock(m_regionAddressMutex);
-  m_regionAddressGetter = std::make_unique<search::RegionAddressGetter>(dataSource, infoGetter);
+  m_regionAddressGetter = std::make_unique<search::RegionAddressGetter>(dataSource, infoGetter, attributesCache);
 }
 
 void BookmarkManager::ResetRegionAddressGetter()
@@ -1820,6 +1861,7 @@ Bookmark * BookmarkManager::AddBookmark(std::unique_ptr<Bookmark> && bookmark)
   CHECK_EQUAL(m_bookmarks.count(markId), 0, ());
   m_bookmarks.emplace(markId, std::move(bookmark));
   m_changesTracker.OnAddMark(markId);
+  m_spatialIndex.AddBookmark(markId, bm->GetPivot());
   return bm;
 }
 
@@ -1831,6 +1873,7 @@ Track * BookmarkManager::AddTrack(std::unique_ptr<Track> && track)
   CHECK_EQUAL(m_tracks.count(trackId), 0, ());
   m_tracks.emplace(trackId, std::move(track));
   m_changesTracker.OnAddLine(trackId);
+  m_spatialIndex.AddTrack(trackId, t->GetLimitRect());
   return t;
 }
 
@@ -1961,6 +2004,7 @@ void BookmarkManager::ClearCategories()
 
   m_bookmarks.clear();
   m_tracks.clear();
+  m_spatialIndex.Clear();
 }
 
 BookmarkManager::KMLDataCollectionPtr BookmarkManager::LoadBookmarks(
@@ -1971,18 +2015,68 @@ BookmarkManager::KMLDataCollectionPtr BookmarkManager::LoadBookmarks(
   Platform::GetFilesByExt(dir, ext, files);
 
   auto collection = std::make_shared<KMLDataCollection>();
-  collection->reserve(files.size());
+  if (files.empty())
+    return collection;
+
+  auto const cacheDir = GetBookmarksCacheDirectory();
+  bool const useCache = fileType != KmlFileType::Binary && Platform::MkDirChecked(cacheDir);
+
+  using LoadingResult = std::pair<std::string /* cachePath */, std::unique_ptr<kml::FileData>>;
+  std::vector<std::future<LoadingResult>> results;
+  results.reserve(files.size());
+
+  // Files are parsed in parallel, but they are passed to the UI in the order of the files list.
+  auto const threadsCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, kMaxLoadingThreadsCount);
+  base::ComputationalThreadPool pool(std::min(threadsCount, files.size()));
   for (auto const & file : files)
   {
-    auto const filePath = base::JoinPath(dir, file);
-    auto kmlData = LoadKmlFile(filePath, fileType);
+    results.push_back(pool.Submit([this, filePath = base::JoinPath(dir, file), fileType, &cacheDir, useCache]()
+    {
+      LoadingResult result;
+      if (m_needTeardown)
+        return result;
+      if (useCache)
+        result.first = GetKmbCachePath(filePath, cacheDir);
+      result.second = LoadKmlFileCached(filePath, fileType, result.first);
+      return result;
+    }));
+  }
+
+  std::unordered_set<std::string> usedCachePaths;
+  size_t itemsCount = 0;
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    auto [cachePath, kmlData] = results[i].get();
+    if (m_needTeardown)
+      break;
+    if (!cachePath.empty())
+      usedCachePaths.insert(std::move(cachePath));
     if (kmlData == nullptr)
       continue;
     if (checker && !checker(*kmlData))
       continue;
-    if (m_needTeardown)
-      break;
-    collection->emplace_back(filePath, std::move(kmlData));
+
+    itemsCount += kmlData->m_bookmarksData.size() + kmlData->m_tracksData.size() + 1;
+    collection->emplace_back(base::JoinPath(dir, files[i]), std::move(kmlData));
+    if (itemsCount >= kLoadingBatchItemsCount && i + 1 < files.size())
+    {
+      NotifyAboutLoadedBookmarks(std::move(collection));
+      collection = std::make_shared<KMLDataCollection>();
+      itemsCount = 0;
+    }
+  }
+
+  if (useCache && !m_needTeardown)
+  {
+    // Remove copies of deleted and changed files.
+    Platform::FilesList cacheFiles;
+    Platform::GetFilesByExt(cacheDir, kKmbExtension, cacheFiles);
+    for (auto const & file : cacheFiles)
+    {
+      auto const cachePath = base::JoinPath(cacheDir, file);
+      if (usedCachePaths.count(cachePath) == 0)
+        base::DeleteFileX(cachePath);
+    }
   }
   return collection;
 }
@@ -2132,6 +2226,17 @@ void BookmarkManager::NotifyAboutStartAsyncLoading()
   });
 }
 
+void BookmarkManager::NotifyAboutLoadedBookmarks(KMLDataCollectionPtr && collection)
+{
+  if (m_needTeardown)
+    return;
+
+  GetPlatform().RunTask(Platform::Thread::Gui, [this, collection]()
+  {
+    CreateCategories(std::move(*collection), true /* autoSave */);
+  });
+}
+
 void BookmarkManager::NotifyAboutFinishAsyncLoading(KMLDataCollectionPtr && collection)
 {
   if (m_needTeardown)
@@ -2530,6 +2635,17 @@ public:
     return false;
   }
 
+  bool FindBookmark()
+  {
+    auto const type = UserMark::Type::BOOKMARK;
+    if (auto const * p = m_manager->FindBookmarkInRect(m_rectHolder(type), m_findOnlyVisible(type), m_d))
+    {
+      m_mark = p;
+      return true;
+    }
+    return false;
+  }
+
   UserMark const * GetFoundMark() const { return m_mark; }
 
 private:
@@ -2567,10 +2683,7 @@ UserMark const * BookmarkManager::FindNearestUserMark(TTouchRectHolder const & h
   }
 
   // Look for the closest bookmark.
-  for (auto const & pair : m_categories)
-    finder(pair.first);
-
-  if (finder.GetFoundMark() != nullptr)
+  if (finder.FindBookmark())
     return finder.GetFoundMark();
 
   // Look for the closest TRACK_INFO or TRACK_SELECTION mark.
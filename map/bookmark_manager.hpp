@@ -2,6 +2,7 @@
 
 #include "map/bookmark.hpp"
 #include "map/bookmark_helpers.hpp"
+#include "map/bookmarks_spatial_index.hpp"
 #include "map/elevation_info.hpp"
 #include "map/track.hpp"
 #include "map/user_mark_layer.hpp"
@@ -36,6 +37,7 @@ class CountryInfoGetter;
 }  // namespace storage
 
 class DataSource;
+class FeatureAttributesCache;
 class SearchAPI;
 
 class BookmarkManager final
@@ -173,8 +175,8 @@ public:
 
   void SetDrapeEngine(ref_ptr<df::DrapeEngine> engine);
 
-  void InitRegionAddressGetter(DataSource const & dataSource,
-                               storage::CountryInfoGetter const & infoGetter);
+  void InitRegionAddressGetter(DataSource const & dataSource, storage::CountryInfoGetter const & infoGetter,
+                               FeatureAttributesCache * attributesCache = nullptr);
   void ResetRegionAddressGetter();
 
   void SetBookmarksChangedCallback(BookmarksChangedCallback && callback);
@@ -298,6 +300,8 @@ public:
   UserMark const * FindNearestUserMark(m2::AnyRectD const & rect) const;
   UserMark const * FindMarkInRect(kml::MarkGroupId groupId, m2::AnyRectD const & rect, bool findOnlyVisible,
                                   double & d) const;
+  /// Finds the nearest to the |rect| center bookmark of visible categories using the spatial index.
+  UserMark const * FindBookmarkInRect(m2::AnyRectD const & rect, bool findOnlyVisible, double & d) const;
 
   /// Scans and loads all kml files with bookmarks.
   void LoadBookmarks();
@@ -614,12 +618,15 @@ private:
   std::string GetMetadataEntryName(kml::MarkGroupId groupId) const;
 
   void NotifyAboutStartAsyncLoading();
+  void NotifyAboutLoadedBookmarks(KMLDataCollectionPtr && collection);
   void NotifyAboutFinishAsyncLoading(KMLDataCollectionPtr && collection);
   void NotifyAboutFile(bool success, std::string const & filePath, bool isTemporaryFile);
   void LoadBookmarkRoutine(std::string const & filePath, bool isTemporaryFile);
   void ReloadBookmarkRoutine(std::string const & filePath);
 
   using BookmarksChecker = std::function<bool(kml::FileData const &)>;
+  // Files are parsed on a pool of threads, loaded files are passed to the UI by batches.
+  // \returns The last batch.
   KMLDataCollectionPtr LoadBookmarks(std::string const & dir, std::string_view ext,
                                      KmlFileType fileType, BookmarksChecker const & checker);
 
@@ -758,6 +765,7 @@ private:
   MarksCollection m_userMarks;
   BookmarksCollection m_bookmarks;
   TracksCollection m_tracks;
+  BookmarksSpatialIndex m_spatialIndex;
 
   StaticMarkPoint * m_selectionMark = nullptr;
   MyPositionMarkPoint * m_myPositionMark = nullptr;
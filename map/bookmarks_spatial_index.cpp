@@ -0,0 +1,50 @@
+#include "map/bookmarks_spatial_index.hpp"
+
+namespace
+{
+// Small trees are not rebuilt, they are fast enough.
+size_t constexpr kMinOptimizedTreeSize = 64;
+}  // namespace
+
+void BookmarksSpatialIndex::AddBookmark(kml::MarkId markId, m2::PointD const & pt)
+{
+  m_bookmarks.Add(markId, m2::RectD(pt, pt));
+  OnAdded(m_bookmarks, m_bookmarksAdded);
+}
+
+void BookmarksSpatialIndex::EraseBookmark(kml::MarkId markId, m2::PointD const & pt)
+{
+  m_bookmarks.Erase(markId, m2::RectD(pt, pt));
+}
+
+void BookmarksSpatialIndex::AddTrack(kml::TrackId trackId, m2::RectD const & limitRect)
+{
+  m_tracks.Add(trackId, limitRect);
+  OnAdded(m_tracks, m_tracksAdded);
+}
+
+void BookmarksSpatialIndex::EraseTrack(kml::TrackId trackId, m2::RectD const & limitRect)
+{
+  m_tracks.Erase(trackId, limitRect);
+}
+
+void BookmarksSpatialIndex::Clear()
+{
+  m_bookmarks.Clear();
+  m_tracks.Clear();
+  m_bookmarksAdded = 0;
+  m_tracksAdded = 0;
+}
+
+// static
+template <typename Tree>
+void BookmarksSpatialIndex::OnAdded(Tree & tree, size_t & addedCount)
+{
+  ++addedCount;
+  auto const size = tree.GetSize();
+  if (size >= kMinOptimizedTreeSize && 2 * addedCount > size)
+  {
+    tree.Optimize();
+    addedCount = 0;
+  }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "kml/type_utils.hpp"
+
+#include "geometry/rect2d.hpp"
+#include "geometry/tree4d.hpp"
+
+#include <cstddef>
+#include <utility>
+
+/// Spatial index of bookmarks pivots and tracks limit rects. It's updated on adding and
+/// deleting of bookmarks and tracks. The kd-tree is not balanced on insertion, so it's rebuilt
+/// when more than a half of its objects were added after the last rebuilding. It keeps
+/// an amortized O(log n) cost of adding and of queries by rect.
+class BookmarksSpatialIndex
+{
+public:
+  void AddBookmark(kml::MarkId markId, m2::PointD const & pt);
+  void EraseBookmark(kml::MarkId markId, m2::PointD const & pt);
+
+  void AddTrack(kml::TrackId trackId, m2::RectD const & limitRect);
+  void EraseTrack(kml::TrackId trackId, m2::RectD const & limitRect);
+
+  void Clear();
+
+  template <typename Fn>
+  void ForEachBookmarkInRect(m2::RectD const & rect, Fn && fn) const
+  {
+    m_bookmarks.ForEachInRect(rect, std::forward<Fn>(fn));
+  }
+
+  template <typename Fn>
+  void ForEachTrackInRect(m2::RectD const & rect, Fn && fn) const
+  {
+    m_tracks.ForEachInRect(rect, std::forward<Fn>(fn));
+  }
+
+  size_t GetBookmarksCount() const { return m_bookmarks.GetSize(); }
+  size_t GetTracksCount() const { return m_tracks.GetSize(); }
+
+private:
+  // Rebuilds the tree if too many objects were added after the last rebuilding.
+  template <typename Tree>
+  static void OnAdded(Tree & tree, size_t & addedCount);
+
+  m4::Tree<kml::MarkId> m_bookmarks;
+  m4::Tree<kml::TrackId> m_tracks;
+  size_t m_bookmarksAdded = 0;
+  size_t m_tracksAdded = 0;
+};
@@ -6,13 +6,42 @@
 
 #include "base/assert.hpp"
 #include "base/logging.hpp"
+#include "base/thread.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <sstream>
+#include <thread>
 
 using platform::CountryFile;
 using platform::LocalCountryFile;
 
-FeaturesFetcher::FeaturesFetcher() { m_dataSource.AddObserver(*this); }
+namespace
+{
+// Ids of the visible tiles and their neighbours are enough for the most of pans and zooms.
+size_t constexpr kTilesCacheSize = 256;
+
+// Reading of more headers at once doesn't speed up the registration on mobile storages.
+size_t constexpr kMaxRegistrationThreads = 4;
+
+uint64_t GetTileKey(m2::RectD const & rect, int scale)
+{
+  // Tiles of the same scale have the same size, so the left bottom corner identifies a tile.
+  auto const x = static_cast<int64_t>(std::lround(rect.minX() / rect.SizeX()));
+  auto const y = static_cast<int64_t>(std::lround(rect.minY() / rect.SizeY()));
+  return (static_cast<uint64_t>(scale) << 48) | ((static_cast<uint64_t>(x) & 0xFFFFFF) << 24) |
+         (static_cast<uint64_t>(y) & 0xFFFFFF);
+}
+}  // namespace
+
+FeaturesFetcher::FeaturesFetcher() : m_tilesCache(kTilesCacheSize) { m_dataSource.AddObserver(*this); }
 
-FeaturesFetcher::~FeaturesFetcher() { m_dataSource.RemoveObserver(*this); }
+FeaturesFetcher::~FeaturesFetcher()
+{
+  m_dataSource.RemoveObserver(*this);
+  LOG(LDEBUG, (GetTilesCacheStats()));
+}
 
 // While reading any files (classificator or mwm), there are 2 types of possible exceptions:
 // Reader::Exception, FileAbsentException.
@@ -30,25 +59,56 @@ void FeaturesFetcher::InitClassificator()
   }
 }
 
-std::pair<MwmSet::MwmId, MwmSet::RegResult> FeaturesFetcher::RegisterMap(
-    LocalCountryFile const & localFile)
+FeaturesFetcher::RegResult FeaturesFetcher::RegisterMap(LocalCountryFile const & localFile)
 {
-  try
+  auto result = RegisterMapImpl(localFile);
+  OnMapRegistrationFinished(localFile, result);
+  return result;
+}
+
+std::vector<FeaturesFetcher::RegResult> FeaturesFetcher::RegisterMaps(std::vector<LocalCountryFile> const & localFiles)
+{
+  std::vector<RegResult> results(localFiles.size());
+
+  // Registration is dominated by small reads of mwm headers, so it's done by several threads.
+  std::atomic<size_t> next = 0;
+  auto const registerMaps = [&]()
   {
-    auto result = m_dataSource.RegisterMap(localFile);
-    if (result.second != MwmSet::RegResult::Success)
-    {
-      LOG(LWARNING, ("Can't add map", localFile.GetCountryName(), "(", result.second, ").",
-                     "Probably it's already added or has newer data version."));
-    }
-    else
-    {
-      MwmSet::MwmId const & id = result.first;
-      ASSERT(id.IsAlive(), ());
-      m_rect.Add(id.GetInfo()->m_bordersRect);
-    }
+    for (size_t i = next++; i < localFiles.size(); i = next++)
+      results[i] = RegisterMapImpl(localFiles[i]);
+  };
 
-    return result;
+  size_t const threadsCount = std::min({static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1U)),
+                                        kMaxRegistrationThreads, localFiles.size()});
+  std::vector<threads::SimpleThread> threads;
+  for (size_t i = 1; i < threadsCount; ++i)
+    threads.emplace_back(registerMaps);
+  registerMaps();
+  for (auto & thread : threads)
+    thread.join();
+
+  for (size_t i = 0; i < localFiles.size(); ++i)
+    OnMapRegistrationFinished(localFiles[i], results[i]);
+
+  if (m_registryCache && m_registryCache->IsChanged())
+    m_registryCache->Save(m_registryCachePath);
+
+  return results;
+}
+
+void FeaturesFetcher::EnableRegistryCache(std::string const & path)
+{
+  m_registryCache = std::make_shared<MwmRegistryCache>();
+  m_registryCachePath = path;
+  m_registryCache->Load(m_registryCachePath);
+  m_dataSource.SetRegistryCache(m_registryCache);
+}
+
+FeaturesFetcher::RegResult FeaturesFetcher::RegisterMapImpl(LocalCountryFile const & localFile)
+{
+  try
+  {
+    return m_dataSource.RegisterMap(localFile);
   }
   catch (RootException const & ex)
   {
@@ -57,14 +117,101 @@ std::pair<MwmSet::MwmId, MwmSet::RegResult> FeaturesFetcher::RegisterMap(
   }
 }
 
+void FeaturesFetcher::OnMapRegistrationFinished(LocalCountryFile const & localFile, RegResult const & result)
+{
+  if (result.second == MwmSet::RegResult::BadFile)
+    return;
+
+  if (result.second != MwmSet::RegResult::Success)
+  {
+    LOG(LWARNING, ("Can't add map", localFile.GetCountryName(), "(", result.second, ").",
+                   "Probably it's already added or has newer data version."));
+  }
+  else
+  {
+    MwmSet::MwmId const & id = result.first;
+    ASSERT(id.IsAlive(), ());
+    m_rect.Add(id.GetInfo()->m_bordersRect);
+  }
+}
+
 bool FeaturesFetcher::DeregisterMap(CountryFile const & countryFile)
 {
   return m_dataSource.Deregister(countryFile);
 }
 
-void FeaturesFetcher::Clear() { m_dataSource.Clear(); }
+void FeaturesFetcher::Clear()
+{
+  m_dataSource.Clear();
+  ClearTileFeatureIdsCache();
+}
+
+void FeaturesFetcher::ClearCaches()
+{
+  m_dataSource.ClearCache();
+  ClearTileFeatureIdsCache();
+}
 
-void FeaturesFetcher::ClearCaches() { m_dataSource.ClearCache(); }
+void FeaturesFetcher::ForEachTileFeatureID(m2::RectD const & rect,
+                                           std::function<void(FeatureID const &)> const & fn,
+                                           int scale) const
+{
+  auto const key = GetTileKey(rect, scale);
+
+  FeatureIds cached;
+  uint64_t generation;
+  {
+    std::lock_guard lock(m_tilesCacheMutex);
+    bool found = false;
+    auto & value = m_tilesCache.Find(key, found);
+    // Value is empty if the ids of the tile are being read by another thread.
+    if (found && value)
+    {
+      cached = value;
+      ++m_tilesCacheStats.m_hits;
+    }
+    else
+    {
+      ++m_tilesCacheStats.m_misses;
+    }
+    generation = m_tilesCacheGeneration;
+  }
+
+  if (cached)
+  {
+    for (auto const & id : *cached)
+      fn(id);
+    return;
+  }
+
+  auto ids = std::make_shared<std::vector<FeatureID>>();
+  ForEachFeatureID(rect, [&](FeatureID const & id)
+  {
+    ids->push_back(id);
+    fn(id);
+  }, scale);
+
+  std::lock_guard lock(m_tilesCacheMutex);
+  // Ids may be outdated if the cache was cleared while reading.
+  if (generation == m_tilesCacheGeneration)
+  {
+    bool found = false;
+    m_tilesCache.Find(key, found) = std::move(ids);
+  }
+}
+
+void FeaturesFetcher::ClearTileFeatureIdsCache()
+{
+  std::lock_guard lock(m_tilesCacheMutex);
+  m_tilesCache.Clear();
+  ++m_tilesCacheGeneration;
+}
+
+FeaturesFetcher::TilesCacheStats FeaturesFetcher::GetTilesCacheStats() const
+{
+  std::lock_guard lock(m_tilesCacheMutex);
+  return m_tilesCacheStats;
+}
 
 m2::RectD FeaturesFetcher::GetWorldRect() const
 {
@@ -76,8 +223,22 @@ m2::RectD FeaturesFetcher::GetWorldRect() const
   return m_rect;
 }
 
+void FeaturesFetcher::OnMapRegistered(platform::LocalCountryFile const & /* localFile */)
+{
+  ClearTileFeatureIdsCache();
+}
+
 void FeaturesFetcher::OnMapDeregistered(platform::LocalCountryFile const & localFile)
 {
+  ClearTileFeatureIdsCache();
+
   if (m_onMapDeregistered)
     m_onMapDeregistered(localFile);
 }
+
+std::string DebugPrint(FeaturesFetcher::TilesCacheStats const & stats)
+{
+  std::ostringstream os;
+  os << "FeaturesFetcher::TilesCacheStats [ hits: " << stats.m_hits << ", misses: " << stats.m_misses << " ]";
+  return os.str();
+}
@@ -2,13 +2,19 @@
 
 #include "editor/editable_data_source.hpp"
 
+#include "indexer/mwm_registry_cache.hpp"
 #include "indexer/mwm_set.hpp"
 
 #include "geometry/rect2d.hpp"
 
 #include "coding/reader.hpp"
 
+#include "base/lru_cache.hpp"
+
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -20,6 +26,12 @@ public:
 
   using MapDeregisteredCallback = std::function<void(platform::LocalCountryFile const &)>;
 
+  struct TilesCacheStats
+  {
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+  };
+
   FeaturesFetcher();
 
   virtual ~FeaturesFetcher();
@@ -31,8 +43,17 @@ public:
     m_onMapDeregistered = callback;
   }
 
+  using RegResult = std::pair<MwmSet::MwmId, MwmSet::RegResult>;
+
   // Registers a new map.
-  std::pair<MwmSet::MwmId, MwmSet::RegResult> RegisterMap(platform::LocalCountryFile const & localFile);
+  RegResult RegisterMap(platform::LocalCountryFile const & localFile);
+  // Registers new maps reading their headers in parallel.
+  // \returns Results in the order of |localFiles|.
+  std::vector<RegResult> RegisterMaps(std::vector<platform::LocalCountryFile> const & localFiles);
+
+  // Enables the registry cache persisted in |path|. Unchanged maps are registered without reading,
+  // the cache is saved by RegisterMaps().
+  void EnableRegistryCache(std::string const & path);
 
   // Deregisters a map denoted by file from internal records.
   bool DeregisterMap(platform::CountryFile const & countryFile);
@@ -57,6 +78,17 @@ public:
     m_dataSource.ForEachFeatureIDInRect(fn, rect, scale, covering::LowLevelsOnly);
   }
 
+  /// The same as ForEachFeatureID, but ids of the recently read tiles are cached, so revisited
+  /// tiles skip the features index lookup. |rect| should be a tile rect.
+  void ForEachTileFeatureID(m2::RectD const & rect, std::function<void(FeatureID const &)> const & fn,
+                            int scale) const;
+
+  /// Should be called when features are edited. Maps (de)registration clears the cache itself.
+  void ClearTileFeatureIdsCache();
+
+  /// Hits and misses of ForEachTileFeatureID since the fetcher creation.
+  TilesCacheStats GetTilesCacheStats() const;
+
   template <class ToDo>
   void ReadFeatures(ToDo & toDo, std::vector<FeatureID> const & features) const
   {
@@ -68,12 +100,30 @@ public:
   m2::RectD GetWorldRect() const;
 
   // MwmSet::Observer overrides:
+  void OnMapRegistered(platform::LocalCountryFile const & localFile) override;
   void OnMapDeregistered(platform::LocalCountryFile const & localFile) override;
 
 private:
+  using FeatureIds = std::shared_ptr<std::vector<FeatureID> const>;
+
+  // Can be called from any thread.
+  RegResult RegisterMapImpl(platform::LocalCountryFile const & localFile);
+  void OnMapRegistrationFinished(platform::LocalCountryFile const & localFile, RegResult const & result);
+
   m2::RectD m_rect;
 
+  mutable std::mutex m_tilesCacheMutex;
+  mutable LruCache<uint64_t, FeatureIds> m_tilesCache;
+  // Is incremented on every cache clearing to not cache ids which were read before it.
+  uint64_t m_tilesCacheGeneration = 0;
+  mutable TilesCacheStats m_tilesCacheStats;
+
   EditableDataSource m_dataSource;
 
   MapDeregisteredCallback m_onMapDeregistered;
+
+  std::shared_ptr<MwmRegistryCache> m_registryCache;
+  std::string m_registryCachePath;
 };
+
+std::string DebugPrint(FeaturesFetcher::TilesCacheStats const & stats);
@@ -57,6 +57,7 @@
 #include "geometry/rect2d.hpp"
 #include "geometry/triangle2d.hpp"
 
+#include "base/file_name_utils.hpp"
 #include "base/logging.hpp"
 #include "base/math.hpp"
 #include "base/string_utils.hpp"
@@ -288,14 +289,6 @@ Framework::Framework(FrameworkParams const & params, bool loadMaps)
   // to a wrong thread. So editor should be initialiazed before serach.
   osm::Editor & editor = osm::Editor::Instance();
 
-  // Restore map style before classificator loading
-  MapStyle mapStyle = kDefaultMapStyle;
-  string mapStyleStr;
-  if (settings::Get(kMapStyleKey, mapStyleStr))
-    mapStyle = MapStyleFromSettings(mapStyleStr);
-  GetStyleReader().SetCurrentStyle(mapStyle);
-  df::LoadTransitColors();
-
   m_connectToGpsTrack = GpsTracker::Instance().IsEnabled();
 
   // Init strings bundle.
@@ -310,67 +303,152 @@ Framework::Framework(FrameworkParams const & params, bool loadMaps)
   // Wi-Fi string is used in categories that's why does not have core_ prefix
   m_stringsBundle.SetDefaultString("wifi", "WiFi");
 
-  m_featuresFetcher.InitClassificator();
   m_featuresFetcher.SetOnMapDeregisteredCallback(bind(&Framework::OnMapDeregistered, this, _1));
-  LOG(LDEBUG, ("Classificator initialized"));
+  m_featuresFetcher.EnableRegistryCache(base::JoinPath(GetPlatform().WritableDir(), MWM_REGISTRY_CACHE_FILE));
+  m_featuresFetcher.GetDataSource().AddObserver(m_featureAttributesCache);
 
-  m_displayedCategories = make_unique<search::DisplayedCategories>(GetDefaultCategories());
+  LOG(LINFO, ("System languages:", languages::GetPreferred()));
 
-  // To avoid possible races - init country info getter in constructor.
-  InitCountryInfoGetter();
-  LOG(LDEBUG, ("Country info getter initialized"));
+  using StageThread = StartupOrchestrator::StageThread;
 
-  InitSearchAPI(params.m_numSearchAPIThreads);
-  LOG(LDEBUG, ("Search API initialized, part 1"));
+  // Restore map style before classificator loading
+  m_startupOrchestrator.AddStage("styles", StageThread::Caller, {}, []()
+  {
+    MapStyle mapStyle = kDefaultMapStyle;
+    string mapStyleStr;
+    if (settings::Get(kMapStyleKey, mapStyleStr))
+      mapStyle = MapStyleFromSettings(mapStyleStr);
+    GetStyleReader().SetCurrentStyle(mapStyle);
+    df::LoadTransitColors();
+  });
 
-  m_bmManager = make_unique<BookmarkManager>(BookmarkManager::Callbacks(
-      [this]() -> StringsBundle const & { return m_stringsBundle; },
-      [this]() -> SearchAPI & { return GetSearchAPI(); },
-      [this](vector<BookmarkInfo> const & marks) { GetSearchAPI().OnBookmarksCreated(marks); },
-      [this](vector<BookmarkInfo> const & marks) { GetSearchAPI().OnBookmarksUpdated(marks); },
-      [this](vector<kml::MarkId> const & marks) { GetSearchAPI().OnBookmarksDeleted(marks); },
-      [this](vector<BookmarkGroupInfo> const & marks) { GetSearchAPI().OnBookmarksAttached(marks); },
-      [this](vector<BookmarkGroupInfo> const & marks) { GetSearchAPI().OnBookmarksDetached(marks); }));
+  m_startupOrchestrator.AddStage("classificator", StageThread::Any, {"styles"}, [this]()
+  {
+    m_featuresFetcher.InitClassificator();
+    UpdateMinBuildingsTapZoom();
+  });
 
-  m_bmManager->InitRegionAddressGetter(m_featuresFetcher.GetDataSource(), *m_infoGetter);
+  // To avoid possible races - init country info getter in constructor.
+  m_startupOrchestrator.AddStage("country_info", StageThread::Any, {}, [this]()
+  {
+    InitCountryInfoGetter();
+  });
 
-  m_routingManager.SetBookmarkManager(m_bmManager.get());
-  m_searchMarks.SetBookmarkManager(m_bmManager.get());
+  m_startupOrchestrator.AddStage("transliteration", StageThread::Any, {}, [this]()
+  {
+    InitTransliteration();
+  });
 
-  m_routingManager.SetTransitManager(&m_transitManager);
+  m_startupOrchestrator.AddStage("categories", StageThread::Any, {"classificator", "transliteration"}, [this]()
+  {
+    m_displayedCategories = make_unique<search::DisplayedCategories>(GetDefaultCategories());
+  });
 
   // Init storage with needed callback.
-  m_storage.Init(bind(&Framework::OnCountryFileDownloaded, this, _1, _2),
-                 bind(&Framework::OnCountryFileDelete, this, _1, _2));
+  m_startupOrchestrator.AddStage("storage", StageThread::Caller, {}, [this]()
+  {
+    m_storage.Init(bind(&Framework::OnCountryFileDownloaded, this, _1, _2),
+                   bind(&Framework::OnCountryFileDelete, this, _1, _2));
+
+    m_storage.SetDownloadingPolicy(&m_storageDownloadingPolicy);
+    m_storage.SetStartDownloadingCallback([this]() { UpdatePlacePageInfoForCurrentSelection(); });
+  });
 
-  m_storage.SetDownloadingPolicy(&m_storageDownloadingPolicy);
-  m_storage.SetStartDownloadingCallback([this]() { UpdatePlacePageInfoForCurrentSelection(); });
+  // Storage is not thread-safe, so maps are registered on the caller thread. Headers of mwms are
+  // read in parallel by FeaturesFetcher::RegisterMaps() meanwhile the stages above run on workers,
+  // none of them touches Storage or the data source.
+  if (loadMaps)
+  {
+    m_startupOrchestrator.AddStage("maps", StageThread::Caller, {"storage"}, [this]()
+    {
+      RegisterAllMaps();
+    });
+  }
 
-  m_routingManager.SetRouterImpl(RouterType::Vehicle);
+  m_startupOrchestrator.AddStage("search", StageThread::Caller, {"country_info", "categories"}, [this, &params]()
+  {
+    InitSearchAPI(params.m_numSearchAPIThreads);
+  });
 
-  UpdateMinBuildingsTapZoom();
+  m_startupOrchestrator.AddStage("bookmarks", StageThread::Caller, {"search"}, [this]()
+  {
+    m_bmManager = make_unique<BookmarkManager>(BookmarkManager::Callbacks(
+        [this]() -> StringsBundle const & { return m_stringsBundle; },
+        [this]() -> SearchAPI & { return GetSearchAPI(); },
+        [this](vector<BookmarkInfo> const & marks) { GetSearchAPI().OnBookmarksCreated(marks); },
+        [this](vector<BookmarkInfo> const & marks) { GetSearchAPI().OnBookmarksUpdated(marks); },
+        [this](vector<kml::MarkId> const & marks) { GetSearchAPI().OnBookmarksDeleted(marks); },
+        [this](vector<BookmarkGroupInfo> const & marks) { GetSearchAPI().OnBookmarksAttached(marks); },
+        [this](vector<BookmarkGroupInfo> const & marks) { GetSearchAPI().OnBookmarksDetached(marks); }));
 
-  LOG(LINFO, ("System languages:", languages::GetPreferred()));
+    m_bmManager->InitRegionAddressGetter(m_featuresFetcher.GetDataSource(), *m_infoGetter, &m_featureAttributesCache);
 
-  editor.SetDelegate(make_unique<search::EditorDelegate>(m_featuresFetcher.GetDataSource()));
-  editor.SetInvalidateFn([this](){ InvalidateRect(GetCurrentViewport()); });
+    m_routingManager.SetBookmarkManager(m_bmManager.get());
+    m_searchMarks.SetBookmarkManager(m_bmManager.get());
+
+    m_routingManager.SetTransitManager(&m_transitManager);
+  });
+
+  // The router reads the country tree which is updated by the registration of local maps.
+  vector<string> routingDependencies = {"bookmarks"};
+  if (loadMaps)
+    routingDependencies.push_back("maps");
+  m_startupOrchestrator.AddStage("routing", StageThread::Caller, routingDependencies, [this]()
+  {
+    m_routingManager.SetRouterImpl(RouterType::Vehicle);
+  });
+
+  m_startupOrchestrator.AddStage("editor", StageThread::Caller, {"classificator"}, [this, &editor]()
+  {
+    editor.SetDelegate(make_unique<search::EditorDelegate>(m_featuresFetcher.GetDataSource()));
+    editor.SetInvalidateFn([this]()
+    {
+      m_featureAttributesCache.Clear();
+      m_featuresFetcher.ClearTileFeatureIdsCache();
+      InvalidateRect(GetCurrentViewport());
+    });
+  });
+
+  /// @todo No any real config loading here for now.
+  m_startupOrchestrator.AddStage("power_manager", StageThread::Caller, {}, [this]()
+  {
+    GetPowerManager().Subscribe(this);
+    GetPowerManager().Load();
+  });
 
   /// @todo Uncomment when we will integrate a traffic provider.
   // m_trafficManager.SetCurrentDataVersion(m_storage.GetCurrentDataVersion());
   // m_trafficManager.SetSimplifiedColorScheme(LoadTrafficSimplifiedColors());
   // m_trafficManager.SetEnabled(LoadTrafficEnabled());
 
-  m_isolinesManager.SetEnabled(LoadIsolinesEnabled());
+  if (loadMaps)
+  {
+    m_startupOrchestrator.AddStage("search_world", StageThread::Caller, {"maps", "search"}, [this]()
+    {
+      GetSearchAPI().InitAfterWorldLoaded();
+    });
 
-  InitTransliteration();
-  LOG(LDEBUG, ("Transliterators initialized"));
+    m_startupOrchestrator.AddStage("edits", StageThread::Caller, {"maps", "editor"}, [this, &editor]()
+    {
+      editor.LoadEdits();
+      m_featuresFetcher.GetDataSource().AddObserver(editor);
+    });
 
-  /// @todo No any real config loading here for now.
-  GetPowerManager().Subscribe(this);
-  GetPowerManager().Load();
+    // Queued downloads must be resumed without the drape engine too (e.g. in tools and tests).
+    m_startupOrchestrator.AddStage("download_queue", StageThread::Caller, {"search_world", "edits"}, [this]()
+    {
+      GetStorage().RestoreDownloadQueue();
+    });
+  }
 
-  if (loadMaps)
-    LoadMapsSync();
+  // Stages below are not needed to show the map and are run after the drape engine is created.
+  m_startupOrchestrator.AddDeferredStage("isolines", [this]()
+  {
+    m_isolinesManager.SetEnabled(LoadIsolinesEnabled());
+  });
+
+  m_startupOrchestrator.Run();
+  LOG(LINFO, ("Framework startup stages:", m_startupOrchestrator.GetTimings()));
 }
 
 Framework::~Framework()
@@ -481,24 +559,7 @@ bool Framework::HasUnsavedEdits(storage::CountryId const & countryId)
   return hasUnsavedChanges;
 }
 
-// Small copy-paste with LoadMapsAsync, but I don't have a better solution.
-void Framework::LoadMapsSync()
-{
-  RegisterAllMaps();
-  LOG(LDEBUG, ("Maps initialized"));
-
-  GetSearchAPI().InitAfterWorldLoaded();
-  LOG(LDEBUG, ("Search API initialized, part 2, after World was loaded"));
-
-  osm::Editor & editor = osm::Editor::Instance();
-  editor.LoadEdits();
-  m_featuresFetcher.GetDataSource().AddObserver(editor);
-  LOG(LDEBUG, ("Editor initialized"));
-
-  GetStorage().RestoreDownloadQueue();
-}
-
-// Small copy-paste with LoadMapsSync, but I don't have a better solution.
+// Small copy-paste with the "maps" stages of the constructor, but I don't have a better solution.
 void Framework::LoadMapsAsync(std::function<void()> && callback)
 {
   osm::Editor & editor = osm::Editor::Instance();
@@ -529,8 +590,19 @@ void Framework::RegisterAllMaps()
 
   vector<shared_ptr<LocalCountryFile>> maps;
   m_storage.GetLocalMaps(maps);
+
+  vector<LocalCountryFile> localFiles;
+  localFiles.reserve(maps.size());
   for (auto const & localFile : maps)
-    UNUSED_VALUE(RegisterMap(*localFile));
+    localFiles.push_back(*localFile);
+
+  auto const results = m_featuresFetcher.RegisterMaps(localFiles);
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    auto const & [id, regResult] = results[i];
+    if (regResult == MwmSet::RegResult::Success)
+      LOG(LINFO, ("Loaded", localFiles[i].GetCountryName(), "map, of version", id.GetInfo()->GetVersion()));
+  }
 }
 
 void Framework::DeregisterAllMaps()
@@ -1446,7 +1518,7 @@ void Framework::CreateDrapeEngine(ref_ptr<dp::GraphicsContextFactory> contextFac
 {
   auto idReadFn = [this](df::MapDataProvider::TReadCallback<FeatureID const> const & fn,
                          m2::RectD const & r,
-                         int scale) -> void { m_featuresFetcher.ForEachFeatureID(r, fn, scale); };
+                         int scale) -> void { m_featuresFetcher.ForEachTileFeatureID(r, fn, scale); };
 
   auto featureReadFn = [this](df::MapDataProvider::TReadCallback<FeatureType> const & fn,
                               vector<FeatureID> const & ids) -> void
@@ -1557,6 +1629,15 @@ void Framework::CreateDrapeEngine(ref_ptr<dp::GraphicsContextFactory> contextFac
     m_drapeEngine->ShowDebugInfo(showDebugInfo);
 
   benchmark::RunGraphicsBenchmark(this);
+
+  // The first frame is being rendered since here, so the rest of initialization may be done.
+  if (!m_startupOrchestrator.IsDeferredRun())
+  {
+    LOG(LINFO, ("Drape engine is created in", m_startupOrchestrator.GetElapsedSeconds(),
+                "seconds since the start of initialization stages"));
+    m_startupOrchestrator.RunDeferred();
+    LOG(LINFO, ("Framework startup stages:", m_startupOrchestrator.GetTimings()));
+  }
 }
 
 void Framework::OnRecoverSurface(int width, int height, bool recreateContextDependentResources)
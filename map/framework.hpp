@@ -14,6 +14,7 @@
 #include "map/routing_mark.hpp"
 #include "map/search_api.hpp"
 #include "map/search_mark.hpp"
+#include "map/startup_orchestrator.hpp"
 #include "map/track.hpp"
 #include "map/traffic_manager.hpp"
 #include "map/transit/transit_reader.hpp"
@@ -34,6 +35,7 @@
 #include "indexer/caching_rank_table_loader.hpp"
 #include "indexer/data_source.hpp"
 #include "indexer/data_source_helpers.hpp"
+#include "indexer/feature_attributes_cache.hpp"
 #include "indexer/map_object.hpp"
 #include "indexer/map_style.hpp"
 
@@ -143,6 +145,10 @@ protected:
 
   StringsBundle m_stringsBundle;
 
+  // Decoded attributes of features which are requested again and again, e.g. cities of
+  // bookmarks addresses. It observes the data source, so it's declared before |m_featuresFetcher|.
+  FeatureAttributesCache m_featureAttributesCache{1000 /* maxSize */};
+
   FeaturesFetcher m_featuresFetcher;
 
   // The order matters here: DisplayedCategories may be used only
@@ -189,6 +195,9 @@ protected:
 
   TrafficManager m_trafficManager;
 
+  // Initialization stages of the constructor, deferred ones are run after the drape engine creation.
+  StartupOrchestrator m_startupOrchestrator;
+
   /// This function will be called by m_storage when latest local files
   /// is downloaded.
   void OnCountryFileDownloaded(storage::CountryId const & countryId,
@@ -218,7 +227,6 @@ public:
   /// \note It works for group and leaf node.
   bool HasUnsavedEdits(storage::CountryId const & countryId);
 
-  void LoadMapsSync();
   void LoadMapsAsync(std::function<void()> && callback);
 
   /// Registers all local map files in internal indexes.
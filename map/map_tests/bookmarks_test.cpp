@@ -11,6 +11,7 @@
 #include "platform/platform.hpp"
 #include "platform/preferred_languages.hpp"
 
+#include "coding/file_reader.hpp"
 #include "coding/internal/file_data.hpp"
 #include "coding/string_utf8_multilang.hpp"
 #include "coding/zip_reader.hpp"
@@ -24,6 +25,7 @@
 #include <numeric>  // std::reduce
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace bookmarks_test
@@ -281,6 +283,80 @@ UNIT_CLASS_TEST(Runner, Bookmarks_ExportKML)
   TEST(base::GetFileSize(fileName, dummy), ());
 }
 
+UNIT_CLASS_TEST(Runner, Bookmarks_KmbCache)
+{
+  string const dir = GetPlatform().TmpPathForFile("bookmarks_cache_test");
+  TEST(Platform::MkDirChecked(dir), ());
+  SCOPE_GUARD(dirDeleter, [&](){ (void)Platform::RmDirRecursively(dir); });
+
+  string const fileName = base::JoinPath(dir, "UnitTestBookmarks.kml");
+  {
+    FileWriter writer(fileName);
+    writer.Write(kmlString, strlen(kmlString));
+  }
+
+  string const cachePath = GetKmbCachePath(fileName, dir);
+  TEST(!cachePath.empty(), ());
+  TEST(!Platform::IsFileExistsByFullPath(cachePath), ());
+
+  auto kmlData = LoadKmlFileCached(fileName, KmlFileType::Text, cachePath);
+  TEST(kmlData, ());
+  TEST(Platform::IsFileExistsByFullPath(cachePath), ());
+
+  // The unchanged file is loaded from the cache: the copy is replaced with another data to check it.
+  {
+    auto const bookmarksCount = kmlData->m_bookmarksData.size();
+    kmlData->m_bookmarksData.pop_back();
+    TEST(SaveKmlFileSafe(*kmlData, cachePath, KmlFileType::Binary), ());
+    auto const cachedData = LoadKmlFileCached(fileName, KmlFileType::Text, cachePath);
+    TEST(cachedData, ());
+    TEST_EQUAL(cachedData->m_bookmarksData.size(), bookmarksCount - 1, ());
+    TEST_EQUAL(cachedData->m_categoryData.m_name, kmlData->m_categoryData.m_name, ());
+  }
+
+  // A file changed without changing its size (and probably its modification time) has another cache path.
+  {
+    FileWriter writer(fileName, FileWriter::OP_WRITE_EXISTING);
+    writer.Write("broken", 6);
+  }
+  TEST_NOT_EQUAL(GetKmbCachePath(fileName, dir), cachePath, ());
+
+  // All lines of multi geometry tracks are kept in the cache.
+  string_view constexpr multiGeometryKml = R"(<?xml version="1.0" encoding="UTF-8"?>
+<kml xmlns="http://www.opengis.net/kml/2.2">
+<Document>
+  <Placemark>
+    <name>Track</name>
+    <MultiGeometry>
+      <LineString>
+        <coordinates>28.968447783842,41.009030507129,0 28.965858,41.018449,0</coordinates>
+      </LineString>
+      <LineString>
+        <coordinates>28.96,41.02,10 28.97,41.03,20 28.98,41.04,30</coordinates>
+      </LineString>
+    </MultiGeometry>
+  </Placemark>
+</Document>
+</kml>)";
+
+  string const multiGeometryFile = base::JoinPath(dir, "UnitTestMultiGeometry.kml");
+  {
+    FileWriter writer(multiGeometryFile);
+    writer.Write(multiGeometryKml.data(), multiGeometryKml.size());
+  }
+  string const multiGeometryCache = GetKmbCachePath(multiGeometryFile, dir);
+  kmlData = LoadKmlFileCached(multiGeometryFile, KmlFileType::Text, multiGeometryCache);
+  TEST(kmlData, ());
+  TEST_EQUAL(kmlData->m_tracksData.size(), 1, ());
+  TEST_EQUAL(kmlData->m_tracksData[0].m_geometry.m_lines.size(), 2, ());
+  TEST(Platform::IsFileExistsByFullPath(multiGeometryCache), ());
+
+  auto const cachedData = LoadKmlData(FileReader(multiGeometryCache), KmlFileType::Binary);
+  TEST(cachedData, ());
+  TEST_EQUAL(cachedData->m_tracksData.size(), 1, ());
+  TEST_EQUAL(cachedData->m_tracksData[0].m_geometry, kmlData->m_tracksData[0].m_geometry, ());
+}
+
 namespace
 {
   void DeleteCategoryFiles(vector<string> const & arrFiles)
@@ -442,6 +518,59 @@ UNIT_TEST(Bookmarks_Getting)
   DeleteCategoryFiles(arrCat);
 }
 
+UNIT_TEST(Bookmarks_SpatialIndex)
+{
+  Framework fm(kFrameworkParams);
+  df::VisualParams::Init(1.0, 1024);
+  fm.OnSize(800, 400);
+  fm.ShowRect(m2::RectD(0, 0, 80, 40));
+
+  BookmarkManager & bmManager = fm.GetBookmarkManager();
+  bmManager.EnableTestMode(true);
+
+  vector<string> const arrCat = {"cat1", "cat2"};
+  auto const cat1 = bmManager.CreateBookmarkCategory(arrCat[0], false /* autoSave */);
+  auto const cat2 = bmManager.CreateBookmarkCategory(arrCat[1], false /* autoSave */);
+
+  // Enough bookmarks to rebuild the index several times.
+  vector<kml::MarkId> ids;
+  for (int x = 0; x < 40; ++x)
+  {
+    for (int y = 0; y < 20; ++y)
+    {
+      kml::BookmarkData bm;
+      kml::SetDefaultStr(bm.m_name, std::to_string(x) + "," + std::to_string(y));
+      bm.m_point = m2::PointD(2 * x + 1, 2 * y + 1);
+      ids.push_back(bmManager.GetEditSession().CreateBookmark(std::move(bm), (x + y) % 2 == 0 ? cat1 : cat2)->GetId());
+    }
+  }
+
+  for (int x = 0; x < 40; x += 3)
+  {
+    for (int y = 0; y < 20; y += 3)
+    {
+      auto const * mark = GetMark(fm, m2::PointD(2 * x + 1, 2 * y + 1));
+      TEST(mark != nullptr, (x, y));
+      TEST_EQUAL(mark->GetId(), ids[x * 20 + y], (x, y));
+    }
+  }
+
+  bmManager.GetEditSession().DeleteBookmark(ids[5 * 20 + 5]);
+  auto const * mark = GetMark(fm, m2::PointD(11, 11));
+  TEST(mark == nullptr || mark->GetId() != ids[5 * 20 + 5], ());
+
+  bmManager.GetEditSession().SetIsVisible(cat1, false);
+  mark = GetMark(fm, m2::PointD(1, 1));
+  TEST(mark == nullptr || mark->GetGroupId() == cat2, ());
+  bmManager.GetEditSession().SetIsVisible(cat1, true);
+
+  bmManager.GetEditSession().ClearGroup(cat2);
+  mark = GetMark(fm, m2::PointD(3, 1));
+  TEST(mark == nullptr || mark->GetGroupId() == cat1, ());
+
+  DeleteCategoryFiles(arrCat);
+}
+
 namespace
 {
 void CheckPlace(Framework const & fm, std::shared_ptr<MwmInfo> const & mwmInfo, double lat, double lon,
@@ -0,0 +1,250 @@
+#include "testing/testing.hpp"
+
+#include "map/features_fetcher.hpp"
+
+#include "search/editor_delegate.hpp"
+#include "search/search_tests_support/helpers.hpp"
+
+#include "generator/generator_tests_support/test_with_custom_mwms.hpp"
+
+#include "editor/editor_tests_support/helpers.hpp"
+#include "editor/osm_editor.hpp"
+
+#include "indexer/scales.hpp"
+
+#include "geometry/mercator.hpp"
+#include "geometry/rect2d.hpp"
+
+#include "base/logging.hpp"
+#include "base/stl_helpers.hpp"
+#include "base/timer.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace features_fetcher_tests
+{
+using namespace generator::tests_support;
+using search::tests_support::TestCafe;
+
+m2::RectD GetTileRect(int zoom, int x, int y)
+{
+  double const tileSize = mercator::Bounds::kRangeX / (1 << zoom);
+  return {mercator::Bounds::kMinX + x * tileSize, mercator::Bounds::kMinY + y * tileSize,
+          mercator::Bounds::kMinX + (x + 1) * tileSize, mercator::Bounds::kMinY + (y + 1) * tileSize};
+}
+
+// Requests tiles of the viewport like drape does: only tiles which were not visible in the previous frame.
+class TilesRequester
+{
+public:
+  explicit TilesRequester(FeaturesFetcher const & fetcher) : m_fetcher(fetcher) {}
+
+  void Show(int zoom, int x, int y)
+  {
+    int constexpr kViewportWidth = 4;
+    int constexpr kViewportHeight = 6;
+
+    std::set<std::pair<int, int>> tiles;
+    for (int i = 0; i < kViewportWidth; ++i)
+    {
+      for (int j = 0; j < kViewportHeight; ++j)
+        tiles.emplace(x + i, y + j);
+    }
+
+    for (auto const & [tx, ty] : tiles)
+    {
+      if (zoom == m_zoom && m_tiles.count({tx, ty}) != 0)
+        continue;
+
+      m_fetcher.ForEachTileFeatureID(GetTileRect(zoom, tx, ty), [](FeatureID const &) {}, zoom);
+    }
+
+    m_zoom = zoom;
+    m_tiles = std::move(tiles);
+  }
+
+private:
+  FeaturesFetcher const & m_fetcher;
+  int m_zoom = -1;
+  std::set<std::pair<int, int>> m_tiles;
+};
+
+UNIT_TEST(FeaturesFetcher_TilesCacheHitRate)
+{
+  FeaturesFetcher fetcher;
+  TilesRequester requester(fetcher);
+
+  int constexpr kZoom = 15;
+  int constexpr kX = 1000;
+  int constexpr kY = 1000;
+  for (int round = 0; round < 3; ++round)
+  {
+    // Pan right and back.
+    for (int i = 0; i < 10; ++i)
+      requester.Show(kZoom, kX + i, kY);
+    for (int i = 10; i >= 0; --i)
+      requester.Show(kZoom, kX + i, kY);
+
+    // Zoom in and out.
+    requester.Show(kZoom + 1, 2 * kX + 2, 2 * kY + 3);
+    requester.Show(kZoom, kX, kY);
+
+    // Pan up and back.
+    for (int i = 0; i < 5; ++i)
+      requester.Show(kZoom, kX, kY + i);
+    for (int i = 5; i >= 0; --i)
+      requester.Show(kZoom, kX, kY + i);
+  }
+
+  auto const stats = fetcher.GetTilesCacheStats();
+  LOG(LINFO, (stats));
+  // Every tile is read only once, all revisits are served by the cache.
+  TEST_EQUAL(stats.m_misses, 128, ());
+  TEST_EQUAL(stats.m_hits, 520, ());
+
+  fetcher.ClearTileFeatureIdsCache();
+  requester.Show(kZoom, kX + 1, kY);
+  TEST_EQUAL(fetcher.GetTilesCacheStats().m_misses, 128 + 6, ());
+}
+
+// Maps are built by TestWithCustomMwms and registered in the fetcher, the editor works with the fetcher
+// and clears its cache on edits like the framework does.
+class FeaturesFetcherTest : public TestWithCustomMwms
+{
+public:
+  FeaturesFetcherTest()
+  {
+    editor::tests_support::SetUpEditorForTesting(
+        std::make_unique<search::EditorDelegate>(m_fetcher.GetDataSource()));
+    osm::Editor::Instance().SetInvalidateFn([this]() { m_fetcher.ClearTileFeatureIdsCache(); });
+  }
+
+  ~FeaturesFetcherTest() override
+  {
+    osm::Editor::Instance().SetInvalidateFn({});
+    editor::tests_support::TearDownEditorForTesting();
+  }
+
+  template <typename BuildFn>
+  MwmSet::MwmId BuildAndRegister(std::string const & name, BuildFn && fn)
+  {
+    auto const id = BuildCountry(name, std::forward<BuildFn>(fn));
+    auto const result = m_fetcher.RegisterMap(id.GetInfo()->GetLocalFile());
+    TEST_EQUAL(result.second, MwmSet::RegResult::Success, ());
+    return result.first;
+  }
+
+  std::vector<FeatureID> GetIds(m2::RectD const & rect, int scale, bool cached) const
+  {
+    std::vector<FeatureID> ids;
+    auto const fn = [&ids](FeatureID const & id) { ids.push_back(id); };
+    if (cached)
+      m_fetcher.ForEachTileFeatureID(rect, fn, scale);
+    else
+      m_fetcher.ForEachFeatureID(rect, fn, scale);
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  // Checks that the cached ids are the same as the ids read from the index on a miss and on a hit.
+  std::vector<FeatureID> CheckTile(m2::RectD const & rect, int scale) const
+  {
+    auto const misses = m_fetcher.GetTilesCacheStats().m_misses;
+    auto const ids = GetIds(rect, scale, false /* cached */);
+    TEST_EQUAL(GetIds(rect, scale, true /* cached */), ids, ());
+    TEST_EQUAL(m_fetcher.GetTilesCacheStats().m_misses, misses + 1, ());
+    TEST_EQUAL(GetIds(rect, scale, true /* cached */), ids, ());
+    TEST_EQUAL(m_fetcher.GetTilesCacheStats().m_misses, misses + 1, ());
+    return ids;
+  }
+
+protected:
+  FeaturesFetcher m_fetcher;
+};
+
+UNIT_CLASS_TEST(FeaturesFetcherTest, TilesCacheOnMwm)
+{
+  int constexpr kScale = scales::GetUpperScale();
+  // Tiles of (0, 0) corner are in [2^(kScale - 1), 2^(kScale - 1) + kTiles).
+  int constexpr kFirstTile = 1 << (kScale - 1);
+  int constexpr kTiles = 4;
+  int constexpr kCafesInRow = 20;
+  double const step = mercator::Bounds::kRangeX / (1 << kScale) * kTiles / kCafesInRow;
+
+  auto const cafesId = BuildAndRegister("Cafes", [&](TestMwmBuilder & builder)
+  {
+    for (int i = 0; i < kCafesInRow; ++i)
+    {
+      for (int j = 0; j < kCafesInRow; ++j)
+        builder.Add(TestCafe({(i + 0.5) * step, (j + 0.5) * step}));
+    }
+  });
+
+  std::vector<m2::RectD> tiles;
+  for (int x = kFirstTile; x < kFirstTile + kTiles; ++x)
+  {
+    for (int y = kFirstTile; y < kFirstTile + kTiles; ++y)
+      tiles.push_back(GetTileRect(kScale, x, y));
+  }
+
+  std::set<FeatureID> allIds;
+  for (auto const & rect : tiles)
+  {
+    auto const ids = CheckTile(rect, kScale);
+    allIds.insert(ids.begin(), ids.end());
+  }
+  TEST_EQUAL(allIds.size(), kCafesInRow * kCafesInRow, ());
+
+  {
+    int constexpr kRounds = 100;
+    base::Timer timer;
+    for (int i = 0; i < kRounds; ++i)
+    {
+      for (auto const & rect : tiles)
+        GetIds(rect, kScale, false /* cached */);
+    }
+    auto const indexTime = timer.ElapsedMilliseconds();
+
+    timer.Reset();
+    for (int i = 0; i < kRounds; ++i)
+    {
+      for (auto const & rect : tiles)
+        GetIds(rect, kScale, true /* cached */);
+    }
+    LOG(LINFO, ("Reading of", kRounds * tiles.size(), "tiles: index", indexTime, "ms, cache",
+                timer.ElapsedMilliseconds(), "ms"));
+  }
+
+  auto const & rect = tiles.front();
+  auto const countFrom = [](std::vector<FeatureID> const & ids, MwmSet::MwmId const & mwmId)
+  {
+    return std::count_if(ids.begin(), ids.end(), [&mwmId](FeatureID const & id) { return id.m_mwmId == mwmId; });
+  };
+
+  // Registration of a map clears the cache.
+  auto const moreCafesId = BuildAndRegister("MoreCafes", [&](TestMwmBuilder & builder)
+  {
+    builder.Add(TestCafe({0.25 * step, 0.25 * step}));
+  });
+  auto ids = CheckTile(rect, kScale);
+  TEST_EQUAL(countFrom(ids, moreCafesId), 1, ());
+
+  // Deregistration of a map clears the cache.
+  TEST(m_fetcher.DeregisterMap(platform::CountryFile("MoreCafes")), ());
+  ids = CheckTile(rect, kScale);
+  TEST_EQUAL(countFrom(ids, moreCafesId), 0, ());
+  TEST_EQUAL(countFrom(ids, cafesId), static_cast<ptrdiff_t>(ids.size()), ());
+
+  // Edits clear the cache.
+  TEST(!ids.empty(), ());
+  auto const deleted = ids.front();
+  osm::Editor::Instance().DeleteFeature(deleted);
+  ids = CheckTile(rect, kScale);
+  TEST(!base::IsExist(ids, deleted), ());
+}
+}  // namespace features_fetcher_tests
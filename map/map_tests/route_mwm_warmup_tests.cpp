@@ -0,0 +1,92 @@
+#include "testing/testing.hpp"
+
+#include "generator/generator_tests_support/test_feature.hpp"
+#include "generator/generator_tests_support/test_mwm_builder.hpp"
+#include "generator/generator_tests_support/test_with_custom_mwms.hpp"
+
+#include "map/route_mwm_warmup.hpp"
+
+#include "platform/country_file.hpp"
+#include "platform/platform.hpp"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace route_mwm_warmup_tests
+{
+using namespace generator::tests_support;
+using namespace std;
+
+class RouteMwmWarmupTest : public TestWithCustomMwms
+{
+public:
+  RouteMwmWarmupTest()
+  {
+    TestPOI poi1(m2::PointD(0, 0), "poi 1", "en");
+    TestPOI poi2(m2::PointD(10, 10), "poi 2", "en");
+    BuildCountry("Wonderland", [&](TestMwmBuilder & builder) { builder.Add(poi1); });
+    BuildCountry("Neverland", [&](TestMwmBuilder & builder) { builder.Add(poi2); });
+  }
+
+  static RouteMwmWarmup::Stats WaitForWarmup(RouteMwmWarmup const & warmup, uint32_t mwmsCount)
+  {
+    for (size_t i = 0; i < 1000; ++i)
+    {
+      auto const stats = warmup.GetStats();
+      if (stats.m_warmedMwms + stats.m_skippedMwms == mwmsCount)
+        return stats;
+      this_thread::sleep_for(chrono::milliseconds(10));
+    }
+    TEST(false, ("Warmup was not finished in time."));
+    return {};
+  }
+
+protected:
+  vector<platform::CountryFile> const m_countries = {platform::CountryFile("Wonderland"),
+                                                     platform::CountryFile("Absent"),
+                                                     platform::CountryFile("Neverland")};
+  Platform::ThreadRunner m_runner;
+};
+
+UNIT_CLASS_TEST(RouteMwmWarmupTest, RouteMwmWarmup_Smoke)
+{
+  RouteMwmWarmup warmup(m_dataSource);
+  warmup.Warmup(m_countries);
+
+  auto const stats = WaitForWarmup(warmup, 3);
+  TEST_EQUAL(stats.m_warmedMwms, 2, ());
+  TEST_EQUAL(stats.m_skippedMwms, 1, ());
+  TEST_GREATER(stats.m_warmedBytes, 0, ());
+
+  warmup.OnMwmEntered("Wonderland");
+  warmup.OnMwmEntered("Wonderland");
+  warmup.OnMwmEntered("Absent");
+  // Not an mwm of the route.
+  warmup.OnMwmEntered("Oz");
+
+  auto const hits = warmup.GetStats();
+  TEST_EQUAL(hits.m_coldHitsAvoided, 1, ());
+  TEST_EQUAL(hits.m_coldHits, 1, ());
+}
+
+UNIT_CLASS_TEST(RouteMwmWarmupTest, RouteMwmWarmup_MemoryBudget)
+{
+  RouteMwmWarmup warmup(m_dataSource, 0 /* memoryBudgetBytes */);
+  warmup.Warmup(m_countries);
+
+  auto const stats = WaitForWarmup(warmup, 3);
+  TEST_EQUAL(stats.m_warmedMwms, 0, ());
+  TEST_EQUAL(stats.m_skippedMwms, 3, ());
+  TEST_EQUAL(stats.m_warmedBytes, 0, ());
+
+  warmup.OnMwmEntered("Neverland");
+  TEST_EQUAL(warmup.GetStats().m_coldHits, 1, ());
+  TEST_EQUAL(warmup.GetStats().m_coldHitsAvoided, 0, ());
+
+  // A new warmup resets the stats.
+  warmup.Warmup({});
+  TEST_EQUAL(warmup.GetStats().m_coldHits, 0, ());
+}
+}  // namespace route_mwm_warmup_tests
@@ -0,0 +1,135 @@
+#include "testing/testing.hpp"
+
+#include "map/startup_orchestrator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace startup_orchestrator_tests
+{
+using namespace std;
+using StageThread = StartupOrchestrator::StageThread;
+
+class OrderChecker
+{
+public:
+  void OnStage(string const & name)
+  {
+    lock_guard lock(m_mutex);
+    m_order.push_back(name);
+  }
+
+  size_t GetPosition(string const & name) const
+  {
+    lock_guard lock(m_mutex);
+    auto const it = find(m_order.cbegin(), m_order.cend(), name);
+    TEST(it != m_order.cend(), (name, m_order));
+    return static_cast<size_t>(distance(m_order.cbegin(), it));
+  }
+
+  size_t GetCount() const
+  {
+    lock_guard lock(m_mutex);
+    return m_order.size();
+  }
+
+private:
+  mutable mutex m_mutex;
+  vector<string> m_order;
+};
+
+UNIT_TEST(StartupOrchestrator_Dependencies)
+{
+  OrderChecker checker;
+  auto const callerId = this_thread::get_id();
+  atomic<bool> callerStagesOnCaller = true;
+
+  StartupOrchestrator orchestrator(3 /* maxWorkersCount */);
+  auto const addStage = [&](string const & name, StageThread thread, vector<string> const & deps)
+  {
+    orchestrator.AddStage(name, thread, deps, [&, name, thread]()
+    {
+      if (thread == StageThread::Caller && this_thread::get_id() != callerId)
+        callerStagesOnCaller = false;
+      checker.OnStage(name);
+    });
+  };
+
+  addStage("styles", StageThread::Caller, {});
+  addStage("classificator", StageThread::Any, {"styles"});
+  addStage("countries", StageThread::Any, {});
+  addStage("maps", StageThread::Any, {});
+  addStage("search", StageThread::Caller, {"classificator", "countries"});
+  addStage("edits", StageThread::Caller, {"maps", "search"});
+
+  bool deferredRun = false;
+  orchestrator.AddDeferredStage("isolines", [&deferredRun]() { deferredRun = true; });
+
+  orchestrator.Run();
+  TEST_EQUAL(checker.GetCount(), 6, ());
+  TEST(callerStagesOnCaller, ());
+  TEST_LESS(checker.GetPosition("styles"), checker.GetPosition("classificator"), ());
+  TEST_LESS(checker.GetPosition("classificator"), checker.GetPosition("search"), ());
+  TEST_LESS(checker.GetPosition("countries"), checker.GetPosition("search"), ());
+  TEST_LESS(checker.GetPosition("search"), checker.GetPosition("edits"), ());
+  TEST_LESS(checker.GetPosition("maps"), checker.GetPosition("edits"), ());
+  TEST(!deferredRun, ());
+  TEST_EQUAL(orchestrator.GetTimings().size(), 6, ());
+
+  orchestrator.RunDeferred();
+  TEST(deferredRun, ());
+  TEST(orchestrator.IsDeferredRun(), ());
+
+  deferredRun = false;
+  orchestrator.RunDeferred();
+  TEST(!deferredRun, ());
+
+  auto const timings = orchestrator.GetTimings();
+  TEST_EQUAL(timings.size(), 7, ());
+  TEST_EQUAL(timings.back().m_name, "isolines", ());
+  TEST(timings.back().m_deferred, ());
+}
+
+UNIT_TEST(StartupOrchestrator_WithoutWorkers)
+{
+  OrderChecker checker;
+  StartupOrchestrator orchestrator(0 /* maxWorkersCount */);
+  orchestrator.AddStage("a", StageThread::Any, {}, [&checker]() { checker.OnStage("a"); });
+  orchestrator.AddStage("b", StageThread::Any, {"a"}, [&checker]() { checker.OnStage("b"); });
+  orchestrator.AddStage("c", StageThread::Caller, {}, [&checker]() { checker.OnStage("c"); });
+
+  orchestrator.Run();
+  TEST_EQUAL(checker.GetCount(), 3, ());
+  TEST_LESS(checker.GetPosition("a"), checker.GetPosition("b"), ());
+}
+
+UNIT_TEST(StartupOrchestrator_Exception)
+{
+  OrderChecker checker;
+  StartupOrchestrator orchestrator(2 /* maxWorkersCount */);
+  orchestrator.AddStage("a", StageThread::Any, {}, []() { throw runtime_error("a"); });
+  orchestrator.AddStage("b", StageThread::Any, {}, [&checker]() { checker.OnStage("b"); });
+  orchestrator.AddStage("c", StageThread::Caller, {"a"}, [&checker]() { checker.OnStage("c"); });
+
+  // Workers are joined and the exception is passed to the caller.
+  bool thrown = false;
+  try
+  {
+    orchestrator.Run();
+  }
+  catch (runtime_error const & e)
+  {
+    thrown = true;
+    TEST_EQUAL(string(e.what()), "a", ());
+  }
+  TEST(thrown, ());
+  // Dependents of the failed stage are not run.
+  TEST_LESS_OR_EQUAL(checker.GetCount(), 1, ());
+}
+}  // namespace startup_orchestrator_tests
@@ -0,0 +1,188 @@
+#include "map/route_mwm_warmup.hpp"
+
+#include "indexer/data_source.hpp"
+#include "indexer/feature_impl.hpp"
+
+#include "platform/platform.hpp"
+
+#include "coding/files_container.hpp"
+
+#include "base/exception.hpp"
+#include "base/logging.hpp"
+#include "base/scope_guard.hpp"
+#include "base/timer.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+#include "defines.hpp"
+
+namespace
+{
+size_t constexpr kReadBlockSize = 64 * 1024;
+}  // namespace
+
+RouteMwmWarmup::RouteMwmWarmup(DataSource & dataSource, uint64_t memoryBudgetBytes)
+  : m_dataSource(dataSource)
+  , m_memoryBudgetBytes(memoryBudgetBytes)
+  , m_state(std::make_shared<State>())
+{
+}
+
+RouteMwmWarmup::~RouteMwmWarmup()
+{
+  Cancel();
+
+  std::unique_lock lock(m_state->m_mutex);
+  m_state->m_cv.wait(lock, [this]() { return !m_state->m_running; });
+}
+
+void RouteMwmWarmup::Warmup(std::vector<platform::CountryFile> const & countries)
+{
+  uint64_t generation;
+  {
+    std::lock_guard lock(m_state->m_mutex);
+    generation = ++m_state->m_generation;
+    m_state->m_planned.clear();
+    for (auto const & file : countries)
+      m_state->m_planned.insert(file.GetName());
+    m_state->m_warmed.clear();
+    m_state->m_entered.clear();
+    m_state->m_stats = {};
+  }
+
+  if (countries.empty())
+    return;
+
+  GetPlatform().RunTask(Platform::Thread::Background,
+                        [&dataSource = m_dataSource, state = m_state, generation, countries,
+                         budget = m_memoryBudgetBytes]()
+  {
+    WarmupImpl(dataSource, state, generation, countries, budget);
+  });
+}
+
+void RouteMwmWarmup::Cancel()
+{
+  ++m_state->m_generation;
+}
+
+void RouteMwmWarmup::OnMwmEntered(std::string const & countryName)
+{
+  std::lock_guard lock(m_state->m_mutex);
+  if (m_state->m_planned.count(countryName) == 0 || !m_state->m_entered.insert(countryName).second)
+    return;
+
+  if (m_state->m_warmed.count(countryName) != 0)
+    ++m_state->m_stats.m_coldHitsAvoided;
+  else
+    ++m_state->m_stats.m_coldHits;
+}
+
+RouteMwmWarmup::Stats RouteMwmWarmup::GetStats() const
+{
+  std::lock_guard lock(m_state->m_mutex);
+  return m_state->m_stats;
+}
+
+// static
+void RouteMwmWarmup::WarmupImpl(DataSource & dataSource, std::shared_ptr<State> const & state,
+                                uint64_t generation, std::vector<platform::CountryFile> const & countries,
+                                uint64_t memoryBudgetBytes)
+{
+  auto const isCancelled = [&state, generation]() { return state->m_generation != generation; };
+
+  {
+    std::lock_guard lock(state->m_mutex);
+    if (isCancelled())
+      return;
+    state->m_running = true;
+  }
+  SCOPE_GUARD(runningGuard, [&state]()
+  {
+    {
+      std::lock_guard lock(state->m_mutex);
+      state->m_running = false;
+    }
+    state->m_cv.notify_all();
+  });
+
+  base::Timer timer;
+  uint64_t warmedBytes = 0;
+  std::vector<char> buffer(kReadBlockSize);
+
+  for (auto const & file : countries)
+  {
+    bool warmed = false;
+    uint64_t mwmBytes = 0;
+    try
+    {
+      // The handle is released at the end of the scope and the opened value gets into the cache.
+      auto const handle = dataSource.GetMwmHandleByCountryFile(file);
+      if (handle.IsAlive())
+      {
+        auto const & value = *handle.GetValue();
+        auto const scalesCount = value.GetHeader().GetScalesCount();
+
+        std::vector<std::string> tags = {ROUTING_FILE_TAG, CROSS_MWM_FILE_TAG, FEATURES_FILE_TAG};
+        if (scalesCount != 0)
+          tags.push_back(feature::GetTagForIndex(GEOMETRY_FILE_TAG, scalesCount - 1));
+
+        std::vector<FilesContainerR::TReader> readers;
+        for (auto const & tag : tags)
+        {
+          if (!value.m_cont.IsExist(tag))
+            continue;
+          readers.push_back(value.m_cont.GetReader(tag));
+          mwmBytes += readers.back().Size();
+        }
+
+        if (warmedBytes + mwmBytes <= memoryBudgetBytes)
+        {
+          for (auto const & reader : readers)
+          {
+            uint64_t const size = reader.Size();
+            for (uint64_t pos = 0; pos < size && !isCancelled(); pos += kReadBlockSize)
+              reader.Read(pos, buffer.data(), static_cast<size_t>(std::min<uint64_t>(kReadBlockSize, size - pos)));
+          }
+          warmed = true;
+        }
+      }
+    }
+    catch (RootException const & ex)
+    {
+      LOG(LWARNING, ("Can't warm up", file, ex.Msg()));
+    }
+
+    std::lock_guard lock(state->m_mutex);
+    if (isCancelled())
+      return;
+
+    if (warmed)
+    {
+      warmedBytes += mwmBytes;
+      state->m_warmed.insert(file.GetName());
+      ++state->m_stats.m_warmedMwms;
+      state->m_stats.m_warmedBytes = warmedBytes;
+    }
+    else
+    {
+      ++state->m_stats.m_skippedMwms;
+    }
+    state->m_stats.m_warmupSeconds = timer.ElapsedSeconds();
+  }
+
+  std::lock_guard lock(state->m_mutex);
+  LOG(LINFO, ("Route mwms warmup:", state->m_stats));
+}
+
+std::string DebugPrint(RouteMwmWarmup::Stats const & stats)
+{
+  std::ostringstream os;
+  os << "RouteMwmWarmup::Stats [ warmed mwms: " << stats.m_warmedMwms
+     << ", skipped mwms: " << stats.m_skippedMwms << ", warmed bytes: " << stats.m_warmedBytes
+     << ", seconds: " << stats.m_warmupSeconds << ", cold hits avoided: " << stats.m_coldHitsAvoided
+     << ", cold hits: " << stats.m_coldHits << " ]";
+  return os.str();
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "platform/country_file.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+class DataSource;
+
+/// Prepares downloaded mwms of a route before they are used while following the route, so the
+/// first use of an mwm in the middle of navigation doesn't pay for its opening and for reading
+/// of its routing and geometry data from the storage.
+/// Mwms are warmed up on the background thread in the order of the route while the memory budget
+/// is not exhausted: an mwm is opened (the value gets into the MwmSet cache), then its routing,
+/// cross-mwm, features and the most detailed geometry sections are read (they get into the page cache).
+/// All methods may be called from any thread.
+class RouteMwmWarmup
+{
+public:
+  struct Stats
+  {
+    uint32_t m_warmedMwms = 0;
+    // Mwms which are absent or don't fit the memory budget.
+    uint32_t m_skippedMwms = 0;
+    uint64_t m_warmedBytes = 0;
+    double m_warmupSeconds = 0.0;
+    // Mwms of the route which were entered after and before their warmup was finished.
+    uint32_t m_coldHitsAvoided = 0;
+    uint32_t m_coldHits = 0;
+  };
+
+  static uint64_t constexpr kDefaultMemoryBudgetBytes = 256 * 1024 * 1024;
+
+  explicit RouteMwmWarmup(DataSource & dataSource,
+                          uint64_t memoryBudgetBytes = kDefaultMemoryBudgetBytes);
+  /// Cancels the warmup and waits until the data source is not used by the background task.
+  ~RouteMwmWarmup();
+
+  /// Cancels the previous warmup and starts a new one for |countries| in the order of the route.
+  void Warmup(std::vector<platform::CountryFile> const & countries);
+  void Cancel();
+
+  /// Should be called when a position on the route enters an mwm.
+  void OnMwmEntered(std::string const & countryName);
+
+  /// Stats of the current (or the last) warmup.
+  Stats GetStats() const;
+
+private:
+  struct State
+  {
+    // Is increased on every start and cancel to stop the running task.
+    std::atomic<uint64_t> m_generation = 0;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    // True while the task uses the data source.
+    bool m_running = false;
+    std::set<std::string> m_planned;
+    std::set<std::string> m_warmed;
+    std::set<std::string> m_entered;
+    Stats m_stats;
+  };
+
+  static void WarmupImpl(DataSource & dataSource, std::shared_ptr<State> const & state,
+                         uint64_t generation, std::vector<platform::CountryFile> const & countries,
+                         uint64_t memoryBudgetBytes);
+
+  DataSource & m_dataSource;
+  uint64_t const m_memoryBudgetBytes;
+  // Shared with the background task which may outlive the warmup.
+  std::shared_ptr<State> m_state;
+};
+
+std::string DebugPrint(RouteMwmWarmup::Stats const & stats);
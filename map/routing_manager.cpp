@@ -36,6 +36,7 @@
 
 #include <ios>
 #include <map>
+#include <set>
 
 #include "cppjansson/cppjansson.hpp"
 
@@ -409,6 +410,7 @@ void RoutingManager::OnBuildRouteReady(Route const & route, RouterResultCode cod
   HidePreviewSegments();
 
   auto const hasWarnings = InsertRoute(route);
+  StartMwmWarmup(route);
   m_drapeEngine.SafeCall(&df::DrapeEngine::StopLocationFollow);
 
   // Validate route (in case of bicycle routing it can be invalid).
@@ -433,9 +435,53 @@ void RoutingManager::OnRebuildRouteReady(Route const & route, RouterResultCode c
     return;
 
   auto const hasWarnings = InsertRoute(route);
+  StartMwmWarmup(route);
   CallRouteBuilded(hasWarnings ? RouterResultCode::HasWarnings : code, storage::CountriesSet());
 }
 
+void RoutingManager::StartMwmWarmup(Route const & route)
+{
+  if (m_currentRouterType == RouterType::Ruler)
+    return;
+
+  auto numMwmIds = make_shared<NumMwmIds>();
+  m_delegate.RegisterCountryFilesOnRoute(numMwmIds);
+
+  // Mwms in the order of the route.
+  vector<platform::CountryFile> countries;
+  set<NumMwmId> added;
+  for (auto const & routeSegment : route.GetRouteSegments())
+  {
+    auto const & segment = routeSegment.GetSegment();
+    if (!segment.IsRealSegment())
+      continue;
+
+    auto const mwmId = segment.GetMwmId();
+    if (numMwmIds->ContainsFileForMwm(mwmId) && added.insert(mwmId).second)
+      countries.push_back(numMwmIds->GetFile(mwmId));
+  }
+
+  if (!m_mwmWarmup)
+    m_mwmWarmup = make_unique<RouteMwmWarmup>(m_callbacks.m_dataSourceGetter());
+
+  m_lastLocationCountryId.clear();
+  m_mwmWarmup->Warmup(countries);
+}
+
+void RoutingManager::CancelMwmWarmup()
+{
+  if (!m_mwmWarmup)
+    return;
+
+  LOG(LINFO, ("Route mwms warmup finished:", m_mwmWarmup->GetStats()));
+  m_mwmWarmup->Cancel();
+}
+
+RouteMwmWarmup::Stats RoutingManager::GetMwmWarmupStats() const
+{
+  return m_mwmWarmup ? m_mwmWarmup->GetStats() : RouteMwmWarmup::Stats();
+}
+
 void RoutingManager::OnNeedMoreMaps(uint64_t routeId, storage::CountriesSet const & absentCountries)
 {
   // No need to inform user about maps needed for the route if the method is called
@@ -451,6 +497,7 @@ void RoutingManager::OnRemoveRoute(routing::RouterResultCode code)
 {
   HidePreviewSegments();
   RemoveRoute(true /* deactivateFollowing */);
+  CancelMwmWarmup();
   CallRouteBuilded(code, storage::CountriesSet());
 }
 
@@ -789,6 +836,7 @@ void RoutingManager::CloseRouting(bool removeRoutePoints)
     m_routingSession.EmitCloseRoutingEvent();
   m_routingSession.Reset();
   RemoveRoute(true /* deactivateFollowing */);
+  CancelMwmWarmup();
 
   if (removeRoutePoints)
   {
@@ -1106,6 +1154,18 @@ void RoutingManager::CheckLocationForRouting(location::GpsInfo const & info)
     return;
 
   SessionState const state = m_routingSession.OnLocationPositionChanged(info);
+
+  if (m_mwmWarmup && state == SessionState::OnRoute)
+  {
+    auto const countryId = m_callbacks.m_countryInfoGetter().GetRegionCountryId(
+        mercator::FromLatLon(info.m_latitude, info.m_longitude));
+    if (countryId != m_lastLocationCountryId)
+    {
+      m_lastLocationCountryId = countryId;
+      m_mwmWarmup->OnMwmEntered(countryId);
+    }
+  }
+
   if (state == SessionState::RouteNeedRebuild)
   {
     m_routingSession.RebuildRoute(
@@ -2,6 +2,7 @@
 
 #include "map/bookmark_manager.hpp"
 #include "map/extrapolation/extrapolator.hpp"
+#include "map/route_mwm_warmup.hpp"
 #include "map/routing_mark.hpp"
 #include "map/transit/transit_display.hpp"
 #include "map/transit/transit_reader.hpp"
@@ -321,10 +322,17 @@ public:
 
   routing::RouterType GetCurrentRouterType() const { return m_currentRouterType; }
 
+  /// Stats of the warmup of mwms of the current (or the last) route.
+  RouteMwmWarmup::Stats GetMwmWarmupStats() const;
+
 private:
   /// \returns true if the route has warnings.
   bool InsertRoute(routing::Route const & route);
 
+  /// Starts the background warmup of downloaded mwms which |route| goes through.
+  void StartMwmWarmup(routing::Route const & route);
+  void CancelMwmWarmup();
+
   struct RoadInfo
   {
     RoadInfo() = default;
@@ -398,5 +406,9 @@ private:
 
   TransitReadManager * m_transitReadManager = nullptr;
 
+  std::unique_ptr<RouteMwmWarmup> m_mwmWarmup;
+  // Country of the last location while following the route.
+  storage::CountryId m_lastLocationCountryId;
+
   DECLARE_THREAD_CHECKER(m_threadChecker);
 };
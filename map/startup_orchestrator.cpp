@@ -0,0 +1,184 @@
+#include "map/startup_orchestrator.hpp"
+
+#include "base/assert.hpp"
+#include "base/logging.hpp"
+#include "base/thread.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+StartupOrchestrator::StartupOrchestrator(size_t maxWorkersCount) : m_maxWorkersCount(maxWorkersCount)
+{
+}
+
+void StartupOrchestrator::AddStage(std::string const & name, StageThread thread,
+                                   std::vector<std::string> const & dependencies, StageFn && fn)
+{
+  CHECK(!m_isRun, (name));
+  CHECK(fn, (name));
+
+  auto const findStage = [this](std::string const & stageName)
+  {
+    return std::find_if(m_stages.begin(), m_stages.end(),
+                        [&stageName](Stage const & stage) { return stage.m_name == stageName; });
+  };
+  CHECK(findStage(name) == m_stages.end(), ("Duplicated stage", name));
+
+  size_t const index = m_stages.size();
+  for (auto const & dependency : dependencies)
+  {
+    auto const it = findStage(dependency);
+    CHECK(it != m_stages.end(), ("Stage", name, "depends on unknown stage", dependency));
+    it->m_dependents.push_back(index);
+  }
+
+  Stage stage;
+  stage.m_name = name;
+  stage.m_thread = thread;
+  stage.m_fn = std::move(fn);
+  stage.m_waitingCount = dependencies.size();
+  m_stages.push_back(std::move(stage));
+}
+
+void StartupOrchestrator::AddDeferredStage(std::string const & name, StageFn && fn)
+{
+  CHECK(!m_isDeferredRun, (name));
+  CHECK(fn, (name));
+  m_deferredStages.emplace_back(name, std::move(fn));
+}
+
+void StartupOrchestrator::Run()
+{
+  CHECK(!m_isRun, ());
+  m_isRun = true;
+
+  size_t anyThreadCount = 0;
+  for (size_t i = 0; i < m_stages.size(); ++i)
+  {
+    auto const & stage = m_stages[i];
+    if (stage.m_thread == StageThread::Any)
+      ++anyThreadCount;
+    if (stage.m_waitingCount == 0)
+      (stage.m_thread == StageThread::Caller ? m_readyForCaller : m_readyForAny).push_back(i);
+  }
+
+  // The calling thread runs stages of any kind too, so workers are needed for the rest of them.
+  size_t const workersCount = std::min(m_maxWorkersCount, anyThreadCount > 0 ? anyThreadCount - 1 : 0);
+  std::vector<threads::SimpleThread> workers;
+  workers.reserve(workersCount);
+  for (size_t i = 0; i < workersCount; ++i)
+    workers.emplace_back([this]() { Work(false /* isCaller */); });
+
+  Work(true /* isCaller */);
+
+  for (auto & worker : workers)
+    worker.join();
+
+  if (m_exception)
+    std::rethrow_exception(m_exception);
+}
+
+void StartupOrchestrator::RunDeferred()
+{
+  CHECK(m_isRun, ());
+  if (m_isDeferredRun)
+    return;
+  m_isDeferredRun = true;
+
+  for (auto const & [name, fn] : m_deferredStages)
+    RunStage(name, fn, true /* deferred */);
+  m_deferredStages.clear();
+}
+
+bool StartupOrchestrator::IsDeferredRun() const
+{
+  return m_isDeferredRun;
+}
+
+std::vector<StartupOrchestrator::StageTiming> StartupOrchestrator::GetTimings() const
+{
+  std::lock_guard lock(m_mutex);
+  return m_timings;
+}
+
+void StartupOrchestrator::Work(bool isCaller)
+{
+  while (true)
+  {
+    size_t index;
+    {
+      std::unique_lock lock(m_mutex);
+      m_cv.wait(lock, [this, isCaller]()
+      {
+        return m_exception || m_finishedCount == m_stages.size() || !m_readyForAny.empty() ||
+               (isCaller && !m_readyForCaller.empty());
+      });
+
+      if (m_exception || m_finishedCount == m_stages.size())
+        return;
+
+      // Stages which may be run on the caller thread only are preferred by the caller.
+      auto & ready = isCaller && !m_readyForCaller.empty() ? m_readyForCaller : m_readyForAny;
+      index = ready.front();
+      ready.pop_front();
+    }
+
+    auto const & stage = m_stages[index];
+    try
+    {
+      RunStage(stage.m_name, stage.m_fn, false /* deferred */);
+    }
+    catch (...)
+    {
+      // Workers must be joined before the exception leaves Run().
+      LOG(LWARNING, ("Startup stage", stage.m_name, "failed"));
+      {
+        std::lock_guard lock(m_mutex);
+        if (!m_exception)
+          m_exception = std::current_exception();
+      }
+      m_cv.notify_all();
+      return;
+    }
+    OnStageFinished(index);
+  }
+}
+
+void StartupOrchestrator::RunStage(std::string const & name, StageFn const & fn, bool deferred)
+{
+  StageTiming timing;
+  timing.m_name = name;
+  timing.m_deferred = deferred;
+  timing.m_startSeconds = m_timer.ElapsedSeconds();
+  fn();
+  timing.m_durationSeconds = m_timer.ElapsedSeconds() - timing.m_startSeconds;
+  LOG(LDEBUG, (timing));
+
+  std::lock_guard lock(m_mutex);
+  m_timings.push_back(std::move(timing));
+}
+
+void StartupOrchestrator::OnStageFinished(size_t index)
+{
+  {
+    std::lock_guard lock(m_mutex);
+    for (size_t const dependent : m_stages[index].m_dependents)
+    {
+      auto & stage = m_stages[dependent];
+      CHECK_GREATER(stage.m_waitingCount, 0, ());
+      if (--stage.m_waitingCount == 0)
+        (stage.m_thread == StageThread::Caller ? m_readyForCaller : m_readyForAny).push_back(dependent);
+    }
+    ++m_finishedCount;
+  }
+  m_cv.notify_all();
+}
+
+std::string DebugPrint(StartupOrchestrator::StageTiming const & timing)
+{
+  std::ostringstream os;
+  os << "StageTiming [ " << timing.m_name << (timing.m_deferred ? " (deferred)" : "")
+     << ", start: " << timing.m_startSeconds << " s, duration: " << timing.m_durationSeconds << " s ]";
+  return os.str();
+}
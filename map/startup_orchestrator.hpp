@@ -0,0 +1,95 @@
+#pragma once
+
+#include "base/macros.hpp"
+#include "base/timer.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/// Runs initialization stages of the Framework taking into account dependencies between them.
+/// Independent stages are run in parallel on worker threads, stages which use thread-checked
+/// subsystems are run on the thread which calls Run(). Deferred stages are not needed to show
+/// the map and are run by RunDeferred() after the first frame.
+/// If a stage throws an exception, the rest of stages are not started and the exception is
+/// rethrown by Run() when running stages are finished.
+class StartupOrchestrator
+{
+public:
+  using StageFn = std::function<void()>;
+
+  enum class StageThread
+  {
+    // The stage is run on the thread which calls Run().
+    Caller,
+    // The stage may be run on any thread in parallel with other stages.
+    Any
+  };
+
+  struct StageTiming
+  {
+    std::string m_name;
+    // Seconds since the creation of the orchestrator.
+    double m_startSeconds = 0.0;
+    double m_durationSeconds = 0.0;
+    bool m_deferred = false;
+  };
+
+  explicit StartupOrchestrator(size_t maxWorkersCount = 2);
+
+  /// All |dependencies| must be added before the stage, so there are no cycles.
+  void AddStage(std::string const & name, StageThread thread,
+                std::vector<std::string> const & dependencies, StageFn && fn);
+  void AddDeferredStage(std::string const & name, StageFn && fn);
+
+  /// Runs all not deferred stages and returns when all of them are finished.
+  /// Rethrows the first exception thrown by a stage.
+  void Run();
+  /// Runs deferred stages on the calling thread. Only the first call does the work.
+  void RunDeferred();
+  bool IsDeferredRun() const;
+
+  /// Timings of finished stages in the order of finishing.
+  std::vector<StageTiming> GetTimings() const;
+  double GetElapsedSeconds() const { return m_timer.ElapsedSeconds(); }
+
+private:
+  struct Stage
+  {
+    std::string m_name;
+    StageThread m_thread = StageThread::Any;
+    StageFn m_fn;
+    std::vector<size_t> m_dependents;
+    size_t m_waitingCount = 0;
+  };
+
+  // Runs stages while not all of them are finished.
+  void Work(bool isCaller);
+  void RunStage(std::string const & name, StageFn const & fn, bool deferred);
+  void OnStageFinished(size_t index);
+
+  base::Timer m_timer;
+  size_t const m_maxWorkersCount;
+
+  std::vector<Stage> m_stages;
+  std::vector<std::pair<std::string, StageFn>> m_deferredStages;
+  bool m_isRun = false;
+  bool m_isDeferredRun = false;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<size_t> m_readyForCaller;
+  std::deque<size_t> m_readyForAny;
+  size_t m_finishedCount = 0;
+  std::exception_ptr m_exception;
+  std::vector<StageTiming> m_timings;
+
+  DISALLOW_COPY_AND_MOVE(StartupOrchestrator);
+};
+
+std::string DebugPrint(StartupOrchestrator::StageTiming const & timing);
@@ -14,11 +14,17 @@ using namespace std;
 
 namespace downloader
 {
-ChunksDownloadStrategy::ChunksDownloadStrategy(vector<string> const & urls)
+ChunksDownloadStrategy::ChunksDownloadStrategy(vector<string> const & urls, size_t connectionsPerServer)
 {
-  // init servers list
-  for (size_t i = 0; i < urls.size(); ++i)
-    m_servers.push_back(ServerT(urls[i], SERVER_READY));
+  ASSERT_GREATER(connectionsPerServer, 0, ());
+
+  // Init servers list. Every connection is a separate server slot, slots of different servers
+  // are interleaved to spread the first chunks across all servers.
+  for (size_t c = 0; c < connectionsPerServer; ++c)
+  {
+    for (size_t i = 0; i < urls.size(); ++i)
+      m_servers.push_back(ServerT(urls[i], SERVER_READY));
+  }
 }
 
 pair<ChunksDownloadStrategy::ChunkT *, int>
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <utility>
@@ -56,7 +57,8 @@ private:
   std::pair<ChunkT *, int> GetChunk(RangeT const & range);
 
 public:
-  ChunksDownloadStrategy(std::vector<std::string> const & urls);
+  /// @param[in]  connectionsPerServer  Number of chunks which are downloaded from one server simultaneously.
+  explicit ChunksDownloadStrategy(std::vector<std::string> const & urls, size_t connectionsPerServer = 1);
 
   /// Init chunks vector for fileSize.
   void InitChunks(int64_t fileSize, int64_t chunkSize, ChunkStatusT status = CHUNK_FREE);
@@ -0,0 +1,86 @@
+#include "platform/chunks_hasher.hpp"
+
+#include "base/logging.hpp"
+
+#include <iterator>
+
+namespace downloader
+{
+ChunksHasher::ChunksHasher(size_t maxPendingSize) : m_maxPendingSize(maxPendingSize) {}
+
+void ChunksHasher::OnWrite(int64_t offset, void const * buffer, size_t size)
+{
+  if (!m_isValid || size == 0)
+    return;
+
+  if (offset < m_hashedSize)
+  {
+    LOG(LDEBUG, ("Data are rewritten at", offset, "hashing is stopped"));
+    Invalidate();
+    return;
+  }
+
+  if (offset == m_hashedSize)
+  {
+    m_hasher.Update(buffer, size);
+    m_hashedSize += static_cast<int64_t>(size);
+    HashPending();
+    return;
+  }
+
+  // Check that the data don't overlap pending ones.
+  auto const next = m_pending.lower_bound(offset);
+  if (next != m_pending.end() && next->first < offset + static_cast<int64_t>(size))
+  {
+    Invalidate();
+    return;
+  }
+  if (next != m_pending.begin())
+  {
+    auto const prev = std::prev(next);
+    if (prev->first + static_cast<int64_t>(prev->second.size()) > offset)
+    {
+      Invalidate();
+      return;
+    }
+  }
+
+  if (m_pendingSize + size > m_maxPendingSize)
+  {
+    LOG(LDEBUG, ("Too many data wait for hashing, hashing is stopped"));
+    Invalidate();
+    return;
+  }
+
+  auto const * data = static_cast<char const *>(buffer);
+  m_pending.emplace_hint(next, offset, std::vector<char>(data, data + size));
+  m_pendingSize += size;
+}
+
+void ChunksHasher::Invalidate()
+{
+  m_isValid = false;
+  m_pending.clear();
+  m_pendingSize = 0;
+}
+
+std::string ChunksHasher::GetBase64(int64_t fileSize)
+{
+  if (!m_isValid || m_hashedSize != fileSize || !m_pending.empty())
+    return {};
+
+  return coding::SHA1::ToBase64(m_hasher.Finish());
+}
+
+void ChunksHasher::HashPending()
+{
+  auto it = m_pending.begin();
+  while (it != m_pending.end() && it->first == m_hashedSize)
+  {
+    m_hasher.Update(it->second.data(), it->second.size());
+    m_hashedSize += static_cast<int64_t>(it->second.size());
+    m_pendingSize -= it->second.size();
+    it = m_pending.erase(it);
+  }
+}
+}  // namespace downloader
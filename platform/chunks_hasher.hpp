@@ -0,0 +1,47 @@
+#pragma once
+
+#include "coding/sha1.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace downloader
+{
+/// Calculates SHA1 of a file which is written by chunks in arbitrary order, so the file
+/// doesn't need to be read again after downloading. Data at the hashed position are hashed
+/// right away, data ahead of it are kept in memory until the gap is filled.
+/// Hashing is stopped (and the file should be hashed after downloading) if some data are
+/// written twice, e.g. a failed chunk is downloaded again, or if too many data wait for a gap.
+/// Single-threaded code.
+class ChunksHasher
+{
+public:
+  static size_t constexpr kDefaultMaxPendingSize = 16 * 1024 * 1024;
+
+  explicit ChunksHasher(size_t maxPendingSize = kDefaultMaxPendingSize);
+
+  void OnWrite(int64_t offset, void const * buffer, size_t size);
+  /// Stops hashing, e.g. if the file was not downloaded from the beginning.
+  void Invalidate();
+
+  bool IsValid() const { return m_isValid; }
+  int64_t GetHashedSize() const { return m_hashedSize; }
+
+  /// @return Base64 encoded SHA1 of the first |fileSize| bytes or empty string if it's not available.
+  std::string GetBase64(int64_t fileSize);
+
+private:
+  void HashPending();
+
+  coding::SHA1::Hasher m_hasher;
+  int64_t m_hashedSize = 0;
+  // Data ahead of |m_hashedSize| by offset.
+  std::map<int64_t, std::vector<char>> m_pending;
+  size_t m_pendingSize = 0;
+  size_t const m_maxPendingSize;
+  bool m_isValid = true;
+};
+}  // namespace downloader
@@ -1,6 +1,7 @@
 #include "platform/http_request.hpp"
 
 #include "platform/chunks_download_strategy.hpp"
+#include "platform/chunks_hasher.hpp"
 #include "platform/http_thread_callback.hpp"
 #include "platform/platform.hpp"
 
@@ -135,6 +136,8 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
 
   string m_filePath;
   unique_ptr<FileWriter> m_writer;
+  ChunksHasher m_hasher;
+  string m_fileSha1;
 
   size_t m_goodChunksCount;
   bool m_doCleanProgressFiles;
@@ -189,6 +192,7 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
     {
       m_writer->Seek(offset);
       m_writer->Write(buffer, size);
+      m_hasher.OnWrite(offset, buffer, size);
       return true;
     }
     catch (Writer::Exception const & e)
@@ -267,6 +271,8 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
     // 3. Clean up resume file with chunks range on success
     if (m_status == DownloadStatus::Completed)
     {
+      m_fileSha1 = m_hasher.GetBase64(m_progress.m_bytesTotal);
+
       Platform::RemoveFileIfExists(m_filePath + RESUME_FILE_EXTENSION);
 
       // Rename finished file to it's original name.
@@ -295,9 +301,9 @@ class FileHttpRequest : public HttpRequest, public IHttpThreadCallback
 public:
   FileHttpRequest(vector<string> const & urls, string const & filePath, int64_t fileSize,
                   Callback && onFinish, Callback && onProgress,
-                  int64_t chunkSize, bool doCleanProgressFiles)
+                  int64_t chunkSize, bool doCleanProgressFiles, size_t connectionsPerServer)
     : HttpRequest(std::move(onFinish), std::move(onProgress)),
-      m_strategy(urls), m_filePath(filePath),
+      m_strategy(urls, connectionsPerServer), m_filePath(filePath),
       m_goodChunksCount(0), m_doCleanProgressFiles(doCleanProgressFiles)
   {
     ASSERT ( !urls.empty(), () );
@@ -314,7 +320,11 @@ public:
       uint64_t size;
       if (base::GetFileSize(filePath + DOWNLOADING_FILE_EXTENSION, size) &&
               size <= static_cast<uint64_t>(fileSize))
+      {
         openMode = FileWriter::OP_WRITE_EXISTING;
+        // Previously downloaded data are not hashed.
+        m_hasher.Invalidate();
+      }
       else
         m_strategy.InitChunks(fileSize, chunkSize);
     }
@@ -356,6 +366,11 @@ public:
   {
     return m_filePath;
   }
+
+  string GetFileSha1() const override
+  {
+    return m_fileSha1;
+  }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -385,12 +400,12 @@ HttpRequest * HttpRequest::PostJson(string const & url, string const & postData,
 HttpRequest * HttpRequest::GetFile(vector<string> const & urls,
                                    string const & filePath, int64_t fileSize,
                                    Callback && onFinish, Callback && onProgress,
-                                   int64_t chunkSize, bool doCleanOnCancel)
+                                   int64_t chunkSize, bool doCleanOnCancel, size_t connectionsPerServer)
 {
   try
   {
     return new FileHttpRequest(urls, filePath, fileSize, std::move(onFinish), std::move(onProgress),
-                               chunkSize, doCleanOnCancel);
+                               chunkSize, doCleanOnCancel, connectionsPerServer);
   }
   catch (FileWriter::Exception const & e)
   {
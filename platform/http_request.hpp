@@ -2,6 +2,7 @@
 
 #include "platform/downloader_defines.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -41,6 +42,9 @@ public:
   Progress const & GetProgress() const { return m_progress; }
   /// Either file path (for chunks) or downloaded data
   virtual std::string const & GetData() const = 0;
+  /// Base64 encoded SHA1 of the downloaded file, it's calculated while downloading.
+  /// Empty if it's not available (e.g. for a resumed download), the file should be read then.
+  virtual std::string GetFileSha1() const { return {}; }
 
   /// Response saved to memory buffer and retrieved with Data()
   static HttpRequest * Get(std::string const & url,
@@ -54,11 +58,13 @@ public:
 
   /// Download file to filePath.
   /// @param[in]  fileSize  Correct file size (needed for resuming and reserving).
+  /// @param[in]  connectionsPerServer  Number of parallel range requests to every url.
   static HttpRequest * GetFile(std::vector<std::string> const & urls,
                                std::string const & filePath, int64_t fileSize,
                                Callback && onFinish,
                                Callback && onProgress = Callback(),
                                int64_t chunkSize = 512 * 1024,
-                               bool doCleanOnCancel = true);
+                               bool doCleanOnCancel = true,
+                               size_t connectionsPerServer = 1);
 };
 } // namespace downloader
@@ -45,7 +45,7 @@ public:
 
   bool IsEditableMap() const;
 
-  /// @name Used in tests only.
+  /// @name Used in tests and by the mwm registry cache.
   /// @{
   void SetFormat(Format format) { m_format = format; }
   void SetSecondsSinceEpoch(uint64_t secondsSinceEpoch) { m_secondsSinceEpoch = secondsSinceEpoch; }
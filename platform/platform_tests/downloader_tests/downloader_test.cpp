@@ -2,11 +2,13 @@
 
 #include "platform/http_request.hpp"
 #include "platform/chunks_download_strategy.hpp"
+#include "platform/chunks_hasher.hpp"
 #include "platform/platform.hpp"
 
 #include "coding/file_reader.hpp"
 #include "coding/file_writer.hpp"
 #include "coding/internal/file_data.hpp"
+#include "coding/sha1.hpp"
 
 #include "base/logging.hpp"
 #include "base/std_serialization.hpp"
@@ -14,6 +16,7 @@
 #include <QtCore/QCoreApplication>
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -331,6 +334,108 @@ UNIT_TEST(ChunksDownloadStrategyFAIL)
   TEST_EQUAL(strategy.NextChunk(s2, r2), ChunksDownloadStrategy::EDownloadFailed, ());
 }
 
+UNIT_TEST(ChunksDownloadStrategyConnectionsPerServer)
+{
+  vector<string> const servers = {"UrlOfServer1", "UrlOfServer2"};
+
+  typedef pair<int64_t, int64_t> RangeT;
+
+  int64_t constexpr kFileSize = 1000;
+  int64_t constexpr kChunkSize = 100;
+  ChunksDownloadStrategy strategy(servers, 3 /* connectionsPerServer */);
+  strategy.InitChunks(kFileSize, kChunkSize);
+  TEST_EQUAL(strategy.ActiveServersCount(), 6, ());
+
+  vector<RangeT> ranges;
+  map<string, int> perServer;
+  string url;
+  RangeT range;
+  while (strategy.NextChunk(url, range) == ChunksDownloadStrategy::ENextChunk)
+  {
+    ranges.push_back(range);
+    ++perServer[url];
+  }
+  TEST_EQUAL(ranges.size(), 6, ());
+  TEST_EQUAL(perServer["UrlOfServer1"], 3, ());
+  TEST_EQUAL(perServer["UrlOfServer2"], 3, ());
+
+  // A failed connection doesn't remove other connections to the same server.
+  strategy.ChunkFinished(false, ranges[0]);
+  TEST_EQUAL(strategy.ActiveServersCount(), 5, ());
+  for (size_t i = 1; i < ranges.size(); ++i)
+    strategy.ChunkFinished(true, ranges[i]);
+
+  size_t started = 0;
+  while (true)
+  {
+    auto const result = strategy.NextChunk(url, range);
+    if (result == ChunksDownloadStrategy::EDownloadSucceeded)
+      break;
+    TEST_EQUAL(result, ChunksDownloadStrategy::ENextChunk, ());
+    strategy.ChunkFinished(true, range);
+    ++started;
+  }
+  TEST_EQUAL(started, 5, ());
+}
+
+UNIT_TEST(ChunksHasher)
+{
+  string data(10000, 0);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<char>(i * 7 + i / 100);
+  string const expected = coding::SHA1::ToBase64(coding::SHA1::CalculateForString(data));
+
+  auto const write = [&data](ChunksHasher & hasher, size_t offset, size_t size)
+  {
+    hasher.OnWrite(offset, data.data() + offset, size);
+  };
+
+  {
+    // Chunks come in arbitrary order.
+    ChunksHasher hasher;
+    write(hasher, 3000, 1000);
+    write(hasher, 5000, 5000);
+    write(hasher, 0, 1000);
+    TEST_EQUAL(hasher.GetHashedSize(), 1000, ());
+    write(hasher, 1000, 2000);
+    TEST_EQUAL(hasher.GetHashedSize(), 4000, ());
+    write(hasher, 4000, 1000);
+    TEST(hasher.IsValid(), ());
+    TEST_EQUAL(hasher.GetHashedSize(), 10000, ());
+    TEST_EQUAL(hasher.GetBase64(data.size()), expected, ());
+  }
+  {
+    // Not all data are written.
+    ChunksHasher hasher;
+    write(hasher, 0, 9000);
+    TEST_EQUAL(hasher.GetBase64(data.size()), "", ());
+  }
+  {
+    // A failed chunk is downloaded again.
+    ChunksHasher hasher;
+    write(hasher, 0, 500);
+    write(hasher, 0, 1000);
+    TEST(!hasher.IsValid(), ());
+    write(hasher, 1000, 9000);
+    TEST_EQUAL(hasher.GetBase64(data.size()), "", ());
+  }
+  {
+    // Data ahead overlap.
+    ChunksHasher hasher;
+    write(hasher, 2000, 1000);
+    write(hasher, 2500, 1000);
+    TEST(!hasher.IsValid(), ());
+  }
+  {
+    // Too many data wait for a gap.
+    ChunksHasher hasher(4000 /* maxPendingSize */);
+    write(hasher, 1000, 3000);
+    TEST(hasher.IsValid(), ());
+    write(hasher, 5000, 2000);
+    TEST(!hasher.IsValid(), ());
+  }
+}
+
 namespace
 {
 string ReadFileAsString(string const & file)
@@ -463,6 +568,30 @@ UNIT_TEST(DownloadChunks)
 }
 
 
+UNIT_TEST(DownloadChunksParallelConnections)
+{
+  string const kFileName = "some_downloader_test_file";
+
+  DeleteTempDownloadFiles();
+
+  DownloadObserver observer;
+  {
+    // 1 url with 4 simultaneous range requests - succeeded
+    unique_ptr<HttpRequest> const request {HttpRequest::GetFile(
+        {kTestUrlBigFile}, kFileName, kBigFileSize,
+        bind(&DownloadObserver::OnDownloadFinish, &observer, _1),
+        bind(&DownloadObserver::OnDownloadProgress, &observer, _1),
+        2048 /* chunkSize */, true /* doCleanOnCancel */, 4 /* connectionsPerServer */)};
+    QCoreApplication::exec();
+    observer.TestOk();
+    TEST_EQUAL(ReadFileAsString(kFileName).size(), kBigFileSize, ());
+    // SHA1 is calculated while downloading.
+    TEST_EQUAL(request->GetFileSha1(), coding::SHA1::CalculateBase64(kFileName), ());
+    FinishDownloadSuccess(kFileName);
+  }
+}
+
+
 namespace
 {
 int64_t constexpr beg1 = 123, end1 = 1230, beg2 = 44000, end2 = 47683;
@@ -49,9 +49,9 @@ private:
     info->m_version.SetFormat(version::Format::lastFormat);
     return info;
   }
-  std::unique_ptr<MwmValue> CreateValue(MwmInfo & info) const override
+  std::unique_ptr<MwmValue> CreateValue(MwmInfo &, platform::LocalCountryFile const & localFile) const override
   {
-    return std::make_unique<MwmValue>(info.GetLocalFile());
+    return std::make_unique<MwmValue>(localFile);
   }
   //@}
 
@@ -7,8 +7,9 @@
 namespace search
 {
 RegionAddressGetter::RegionAddressGetter(DataSource const & dataSource,
-                                         storage::CountryInfoGetter const & infoGetter)
-  : m_reverseGeocoder(dataSource), m_cityFinder(dataSource), m_infoGetter(infoGetter)
+                                         storage::CountryInfoGetter const & infoGetter,
+                                         FeatureAttributesCache * attributesCache)
+  : m_reverseGeocoder(dataSource, attributesCache), m_cityFinder(dataSource), m_infoGetter(infoGetter)
 {
   m_nameGetter.LoadCountriesTree();
   m_nameGetter.SetLocale(languages::GetCurrentNorm());
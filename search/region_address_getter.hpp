@@ -15,7 +15,8 @@ namespace search
 class RegionAddressGetter
 {
 public:
-  RegionAddressGetter(DataSource const & dataSource, storage::CountryInfoGetter const & infoGetter);
+  RegionAddressGetter(DataSource const & dataSource, storage::CountryInfoGetter const & infoGetter,
+                      FeatureAttributesCache * attributesCache = nullptr);
 
   ReverseGeocoder::RegionAddress GetNearbyRegionAddress(m2::PointD const & center);
   std::string GetLocalizedRegionAddress(ReverseGeocoder::RegionAddress const & addr) const;
@@ -13,9 +13,13 @@
 #include "indexer/fake_feature_ids.hpp"
 #include "indexer/feature.hpp"
 #include "indexer/feature_algo.hpp"
+#include "indexer/feature_attributes_cache.hpp"
+#include "indexer/feature_utils.hpp"
 #include "indexer/ftypes_matcher.hpp"
 #include "indexer/scales.hpp"
 
+#include "platform/preferred_languages.hpp"
+
 #include "base/stl_helpers.hpp"
 
 #include <algorithm>
@@ -75,7 +79,10 @@ std::string const & GetHouseNumber(FeatureType & ft)
 
 }  // namespace
 
-ReverseGeocoder::ReverseGeocoder(DataSource const & dataSource) : m_dataSource(dataSource) {}
+ReverseGeocoder::ReverseGeocoder(DataSource const & dataSource, FeatureAttributesCache * attributesCache)
+  : m_dataSource(dataSource), m_attributesCache(attributesCache)
+{
+}
 
 template <class ObjT, class FilterT>
 vector<ObjT> GetNearbyObjects(search::MwmContext & context, m2::PointD const & center,
@@ -313,7 +320,23 @@ string ReverseGeocoder::GetLocalizedRegionAddress(RegionAddress const & addr,
   string addrStr;
   if (addr.m_featureId.IsValid())
   {
-    m_dataSource.ReadFeature([&addrStr](FeatureType & ft) { addrStr = ft.GetReadableName(); }, addr.m_featureId);
+    if (m_attributesCache != nullptr)
+    {
+      auto const attrs = m_attributesCache->Get(m_dataSource, addr.m_featureId);
+      auto const & mwmInfo = addr.m_featureId.m_mwmId.GetInfo();
+      if (attrs && mwmInfo)
+      {
+        feature::NameParamsOut out;
+        feature::GetReadableName({attrs->m_names, mwmInfo->GetRegionData(),
+                                  StringUtf8Multilang::GetLangIndex(languages::GetCurrentNorm()),
+                                  false /* allowTranslit */}, out);
+        addrStr = out.primary;
+      }
+    }
+    else
+    {
+      m_dataSource.ReadFeature([&addrStr](FeatureType & ft) { addrStr = ft.GetReadableName(); }, addr.m_featureId);
+    }
 
     auto const countryName = addr.GetCountryName();
     if (!countryName.empty())
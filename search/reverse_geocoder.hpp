@@ -12,8 +12,9 @@
 #include <string>
 #include <vector>
 
-class FeatureType;
 class DataSource;
+class FeatureAttributesCache;
+class FeatureType;
 
 namespace storage
 {
@@ -29,6 +30,7 @@ class RegionInfoGetter;
 class ReverseGeocoder
 {
   DataSource const & m_dataSource;
+  FeatureAttributesCache * m_attributesCache;
 
   struct Object
   {
@@ -51,7 +53,9 @@ public:
   /// All "Nearby" functions work in this lookup radius.
   static int constexpr kLookupRadiusM = 500;
 
-  explicit ReverseGeocoder(DataSource const & dataSource);
+  /// |attributesCache| is optional, it's used to get names of regions (cities) which are
+  /// requested again and again for the same features.
+  explicit ReverseGeocoder(DataSource const & dataSource, FeatureAttributesCache * attributesCache = nullptr);
 
   struct Street : public Object
   {
@@ -0,0 +1,159 @@
+#include "storage/country_cells_index.hpp"
+
+#include "geometry/mercator.hpp"
+#include "geometry/rect_intersect.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace storage
+{
+namespace
+{
+// Edges near a cell are considered as crossing it to not depend on rounding errors.
+double constexpr kCellEps = 1e-7;
+}  // namespace
+
+struct CountryCellsIndex::Builder
+{
+  Builder(CountriesBorders const & countries, uint8_t maxDepth, std::vector<uint32_t> & nodes)
+    : m_countries(countries), m_maxDepth(maxDepth), m_nodes(nodes)
+  {
+  }
+
+  bool Contains(RegionId id, m2::PointD const & pt) const
+  {
+    return std::any_of(m_countries[id].begin(), m_countries[id].end(),
+                       [&pt](m2::RegionD const & region) { return region.Contains(pt); });
+  }
+
+  // |edges| are the edges of the parent cell. |covering| are the countries which cover the parent
+  // cell without crossing it, they cover all its children too.
+  void BuildNode(size_t nodeIndex, m2::RectD const & rect, uint8_t depth, std::vector<Edge> const & parentEdges,
+                 std::vector<RegionId> covering)
+  {
+    m2::RectD inflatedRect = rect;
+    inflatedRect.Inflate(kCellEps, kCellEps);
+
+    std::vector<Edge> edges;
+    std::vector<RegionId> crossing;
+    std::vector<RegionId> parentCrossing;
+    for (auto const & edge : parentEdges)
+    {
+      if (parentCrossing.empty() || parentCrossing.back() != edge.m_regionId)
+        parentCrossing.push_back(edge.m_regionId);
+
+      auto p1 = edge.m_p1;
+      auto p2 = edge.m_p2;
+      if (!m2::Intersect(inflatedRect, p1, p2))
+        continue;
+
+      edges.push_back(edge);
+      if (crossing.empty() || crossing.back() != edge.m_regionId)
+        crossing.push_back(edge.m_regionId);
+    }
+
+    // A country which crosses the parent cell and doesn't cross this one either covers the cell or not.
+    auto const center = rect.Center();
+    for (auto const id : parentCrossing)
+    {
+      if (!std::binary_search(crossing.begin(), crossing.end(), id) && Contains(id, center))
+        covering.push_back(id);
+    }
+    std::sort(covering.begin(), covering.end());
+
+    RegionId const firstCovering = covering.empty() ? kNoRegion : covering.front();
+    RegionId const firstCrossing = crossing.empty() ? kNoRegion : crossing.front();
+    if (firstCovering < firstCrossing)
+    {
+      m_nodes[nodeIndex] = kFirstRegion + static_cast<uint32_t>(firstCovering);
+      return;
+    }
+
+    if (firstCrossing == kNoRegion)
+    {
+      m_nodes[nodeIndex] = kOutside;
+      return;
+    }
+
+    if (depth == m_maxDepth)
+    {
+      m_nodes[nodeIndex] = kBoundary;
+      return;
+    }
+
+    size_t const firstChild = m_nodes.size();
+    m_nodes[nodeIndex] = kChildrenFlag | static_cast<uint32_t>(firstChild);
+    m_nodes.resize(firstChild + 4, kOutside);
+    for (size_t i = 0; i < 4; ++i)
+      BuildNode(firstChild + i, GetChildRect(rect, i), depth + 1, edges, covering);
+  }
+
+  CountriesBorders const & m_countries;
+  uint8_t const m_maxDepth;
+  std::vector<uint32_t> & m_nodes;
+};
+
+void CountryCellsIndex::Build(CountriesBorders const & countries, uint8_t maxDepth)
+{
+  CHECK_LESS(countries.size(), kChildrenFlag - kFirstRegion, ());
+  CHECK_LESS(maxDepth, kMaxSupportedDepth, ());
+
+  // Edges are grouped by countries in the order of ids.
+  std::vector<Edge> edges;
+  for (size_t id = 0; id < countries.size(); ++id)
+  {
+    for (auto const & region : countries[id])
+    {
+      auto const & points = region.Data();
+      for (size_t i = 0; i < points.size(); ++i)
+        edges.push_back({points[i], points[(i + 1) % points.size()], static_cast<uint32_t>(id)});
+    }
+  }
+
+  m_nodes.assign(1, kOutside);
+  Builder builder(countries, maxDepth, m_nodes);
+  builder.BuildNode(0 /* nodeIndex */, mercator::Bounds::FullRect(), 0 /* depth */, edges, {} /* covering */);
+}
+
+bool CountryCellsIndex::Find(m2::PointD const & pt, RegionId & id) const
+{
+  m2::RectD rect = mercator::Bounds::FullRect();
+  if (m_nodes.empty() || !rect.IsPointInside(pt))
+    return false;
+
+  uint32_t value = m_nodes.front();
+  while ((value & kChildrenFlag) != 0)
+  {
+    size_t const child = GetChild(rect, pt);
+    rect = GetChildRect(rect, child);
+    value = m_nodes[(value & ~kChildrenFlag) + child];
+  }
+
+  switch (value)
+  {
+  case kOutside: id = kNoRegion; return true;
+  case kBoundary: return false;
+  default: id = value - kFirstRegion; return true;
+  }
+}
+
+// static
+m2::RectD CountryCellsIndex::GetChildRect(m2::RectD const & rect, size_t child)
+{
+  ASSERT_LESS(child, 4, ());
+  auto const center = rect.Center();
+  double const minX = (child & 1) == 0 ? rect.minX() : center.x;
+  double const maxX = (child & 1) == 0 ? center.x : rect.maxX();
+  double const minY = (child & 2) == 0 ? rect.minY() : center.y;
+  double const maxY = (child & 2) == 0 ? center.y : rect.maxY();
+  return {minX, minY, maxX, maxY};
+}
+
+// static
+size_t CountryCellsIndex::GetChild(m2::RectD const & rect, m2::PointD const & pt)
+{
+  auto const center = rect.Center();
+  return (pt.x >= center.x ? 1 : 0) | (pt.y >= center.y ? 2 : 0);
+}
+}  // namespace storage
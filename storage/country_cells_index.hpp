@@ -0,0 +1,120 @@
+#pragma once
+
+#include "coding/varint.hpp"
+
+#include "geometry/point2d.hpp"
+#include "geometry/rect2d.hpp"
+#include "geometry/region2d.hpp"
+
+#include "base/assert.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace storage
+{
+/// Quadtree over the mercator plane which leaves are marked as outside of all countries,
+/// inside a country or as a boundary. A point belongs to the first country which contains it,
+/// so a leaf is inside a country if the cell is covered by the country and isn't touched by
+/// the previous ones. It's built by the generator from the packed polygons and is stored in
+/// the same file, so points in inner cells are found without loading of borders.
+class CountryCellsIndex
+{
+public:
+  using RegionId = size_t;
+  using CountriesBorders = std::vector<std::vector<m2::RegionD>>;
+
+  static RegionId constexpr kNoRegion = std::numeric_limits<RegionId>::max();
+  // Cells of the max depth are about 40 km at the equator.
+  static uint8_t constexpr kMaxDepth = 10;
+  // Deeper indices are not loaded, it protects from broken data.
+  static uint8_t constexpr kMaxSupportedDepth = 24;
+
+  /// Builds the index by borders of countries in the order of their ids.
+  void Build(CountriesBorders const & countries, uint8_t maxDepth = kMaxDepth);
+
+  void Clear() { m_nodes.clear(); }
+  bool IsEmpty() const { return m_nodes.empty(); }
+  size_t GetNodesCount() const { return m_nodes.size(); }
+
+  /// \returns false if |pt| is in a boundary cell or the index is empty. Otherwise |id| is
+  /// the country |pt| belongs to or kNoRegion if it's out of all countries.
+  bool Find(m2::PointD const & pt, RegionId & id) const;
+
+  template <typename Sink>
+  void Serialize(Sink & sink) const
+  {
+    if (!m_nodes.empty())
+      SerializeNode(sink, 0 /* nodeIndex */);
+  }
+
+  template <typename Source>
+  void Deserialize(Source & src)
+  {
+    m_nodes.assign(1, kOutside);
+    DeserializeNode(src, 0 /* nodeIndex */, 0 /* depth */);
+  }
+
+private:
+  // Values of nodes. A value with kChildrenFlag is an index of the first of four children,
+  // values from kFirstRegion are ids of countries shifted by kFirstRegion.
+  static uint32_t constexpr kOutside = 0;
+  static uint32_t constexpr kBoundary = 1;
+  static uint32_t constexpr kFirstRegion = 2;
+  static uint32_t constexpr kChildrenFlag = uint32_t(1) << 31;
+  // Serialized value of a node with children.
+  static uint32_t constexpr kSerializedParent = std::numeric_limits<uint32_t>::max();
+
+  struct Edge
+  {
+    m2::PointD m_p1;
+    m2::PointD m_p2;
+    uint32_t m_regionId;
+  };
+
+  struct Builder;
+
+  // Children are ordered as left bottom, right bottom, left top and right top.
+  static m2::RectD GetChildRect(m2::RectD const & rect, size_t child);
+  static size_t GetChild(m2::RectD const & rect, m2::PointD const & pt);
+
+  template <typename Sink>
+  void SerializeNode(Sink & sink, size_t nodeIndex) const
+  {
+    uint32_t const value = m_nodes[nodeIndex];
+    if ((value & kChildrenFlag) == 0)
+    {
+      WriteVarUint(sink, value);
+      return;
+    }
+
+    WriteVarUint(sink, kSerializedParent);
+    size_t const firstChild = value & ~kChildrenFlag;
+    for (size_t i = 0; i < 4; ++i)
+      SerializeNode(sink, firstChild + i);
+  }
+
+  template <typename Source>
+  void DeserializeNode(Source & src, size_t nodeIndex, uint8_t depth)
+  {
+    auto const value = ReadVarUint<uint32_t>(src);
+    if (value != kSerializedParent)
+    {
+      CHECK_EQUAL(value & kChildrenFlag, 0, ());
+      m_nodes[nodeIndex] = value;
+      return;
+    }
+
+    CHECK_LESS(depth, kMaxSupportedDepth, ());
+    size_t const firstChild = m_nodes.size();
+    m_nodes[nodeIndex] = kChildrenFlag | static_cast<uint32_t>(firstChild);
+    m_nodes.resize(firstChild + 4, kOutside);
+    for (size_t i = 0; i < 4; ++i)
+      DeserializeNode(src, firstChild + i, depth + 1);
+  }
+
+  std::vector<uint32_t> m_nodes;
+};
+}  // namespace storage
@@ -12,18 +12,22 @@
 #include "geometry/region2d.hpp"
 
 #include "base/logging.hpp"
+#include "base/stl_helpers.hpp"
 #include "base/string_utils.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <utility>
 
+#include "defines.hpp"
 
 namespace storage
 {
 namespace
 {
 size_t const kInvalidId = std::numeric_limits<size_t>::max();
+static_assert(kInvalidId == CountryCellsIndex::kNoRegion);
 }  // namespace
 
 // CountryInfoGetterBase ---------------------------------------------------------------------------
@@ -33,9 +37,70 @@ CountryId CountryInfoGetterBase::GetRegionCountryId(m2::PointD const & pt) const
   return id == kInvalidId ? kInvalidCountryId : m_countries[id].m_countryId;
 }
 
+void CountryInfoGetterBase::GetRegionCountryIds(std::vector<m2::PointD> const & points,
+                                                CountriesVec & countryIds) const
+{
+  countryIds.assign(points.size(), kInvalidCountryId);
+
+  // Indices of points in boundary cells.
+  std::vector<size_t> rest;
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    RegionId id;
+    if (!m_cellsIndex.Find(points[i], id))
+      rest.push_back(i);
+    else if (id != kInvalidId)
+      countryIds[i] = m_countries[id].m_countryId;
+  }
+
+  // Countries are checked in the order of ids to get the first one containing a point.
+  std::vector<m2::PointD> candidates;
+  std::vector<size_t> candidatesIndices;
+  std::vector<bool> belongs;
+  for (RegionId id = 0; id < m_countries.size() && !rest.empty(); ++id)
+  {
+    candidates.clear();
+    candidatesIndices.clear();
+    for (size_t i = 0; i < rest.size(); ++i)
+    {
+      if (m_countries[id].m_rect.IsPointInside(points[rest[i]]))
+      {
+        candidates.push_back(points[rest[i]]);
+        candidatesIndices.push_back(i);
+      }
+    }
+
+    if (candidates.empty())
+      continue;
+
+    belongs.assign(candidates.size(), false);
+    CheckPointsInRegion(id, candidates, belongs);
+    for (size_t i = 0; i < candidates.size(); ++i)
+    {
+      if (!belongs[i])
+        continue;
+      auto & pointIndex = rest[candidatesIndices[i]];
+      countryIds[pointIndex] = m_countries[id].m_countryId;
+      pointIndex = kInvalidId;
+    }
+    base::EraseIf(rest, [](size_t pointIndex) { return pointIndex == kInvalidId; });
+  }
+}
+
 bool CountryInfoGetterBase::BelongsToAnyRegion(m2::PointD const & pt,
                                                RegionIdVec const & regions) const
 {
+  // The index keeps the first country containing a point only, borders of the other countries
+  // may overlap it, so they are checked as usual.
+  RegionId countryId;
+  if (m_cellsIndex.Find(pt, countryId))
+  {
+    if (countryId == kInvalidId)
+      return false;
+    if (base::IsExist(regions, countryId))
+      return true;
+  }
+
   for (auto const & id : regions)
   {
     if (BelongsToRegion(pt, id))
@@ -57,6 +122,10 @@ bool CountryInfoGetterBase::BelongsToAnyRegion(CountryId const & countryId,
 
 CountryInfoGetterBase::RegionId CountryInfoGetterBase::FindFirstCountry(m2::PointD const & pt) const
 {
+  RegionId countryId;
+  if (m_cellsIndex.Find(pt, countryId))
+    return countryId;
+
   for (size_t id = 0; id < m_countries.size(); ++id)
   {
     if (BelongsToRegion(pt, id))
@@ -66,6 +135,24 @@ CountryInfoGetterBase::RegionId CountryInfoGetterBase::FindFirstCountry(m2::Poin
   return kInvalidId;
 }
 
+void CountryInfoGetterBase::CheckPointsInRegion(size_t id, std::vector<m2::PointD> const & points,
+                                                std::vector<bool> & belongs) const
+{
+  ASSERT_EQUAL(points.size(), belongs.size(), ());
+  for (size_t i = 0; i < points.size(); ++i)
+    belongs[i] = BelongsToRegion(points[i], id);
+}
+
+void CountryInfoGetterBase::LoadCellsIndex(FilesContainerR const & reader)
+{
+  m_cellsIndex.Clear();
+  if (!reader.IsExist(PACKED_POLYGONS_CELLS_TAG))
+    return;
+
+  ReaderSource<ModelReaderPtr> src(reader.GetReader(PACKED_POLYGONS_CELLS_TAG));
+  m_cellsIndex.Deserialize(src);
+}
+
 // CountryInfoGetter -------------------------------------------------------------------------------
 std::vector<CountryId> CountryInfoGetter::GetRegionsCountryIdByRect(m2::RectD const & rect,
                                                                     bool rough) const
@@ -234,6 +321,7 @@ CountryInfoReader::CountryInfoReader(ModelReaderPtr polyR, ModelReaderPtr countr
 {
   ReaderSource<ModelReaderPtr> src(m_reader.GetReader(PACKED_POLYGONS_INFO_TAG));
   rw::Read(src, m_countries);
+  LoadCellsIndex(m_reader);
 
   m_countryIndex.reserve(m_countries.size());
   for (size_t i = 0; i < m_countries.size(); ++i)
@@ -284,6 +372,24 @@ bool CountryInfoReader::BelongsToRegion(m2::PointD const & pt, size_t id) const
   return WithRegion(id, contains);
 }
 
+void CountryInfoReader::CheckPointsInRegion(size_t id, std::vector<m2::PointD> const & points,
+                                            std::vector<bool> & belongs) const
+{
+  ASSERT_EQUAL(points.size(), belongs.size(), ());
+  auto const & rect = m_countries[id].m_rect;
+  WithRegion(id, [&](std::vector<m2::RegionD> const & regions)
+  {
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+      if (!rect.IsPointInside(points[i]))
+        continue;
+
+      belongs[i] = std::any_of(regions.begin(), regions.end(),
+                               [&](m2::RegionD const & region) { return region.Contains(points[i]); });
+    }
+  });
+}
+
 bool CountryInfoReader::IsIntersectedByRegion(m2::RectD const & rect, size_t id) const
 {
   std::vector<std::pair<m2::PointD, m2::PointD>> const edges = {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "storage/country_cells_index.hpp"
 #include "storage/country_decl.hpp"
 #include "storage/storage_defines.hpp"
 
@@ -37,6 +38,11 @@ public:
   // string.
   CountryId GetRegionCountryId(m2::PointD const & pt) const;
 
+  // Fills |countryIds| with GetRegionCountryId() results for |points|. Points in inner cells
+  // of the cells index are resolved without locks and borders, borders of a country are used
+  // once for all the other points, so it's much faster for big batches.
+  void GetRegionCountryIds(std::vector<m2::PointD> const & points, CountriesVec & countryIds) const;
+
   // Returns true when |pt| belongs to at least one of the specified
   // |regions|.
   bool BelongsToAnyRegion(m2::PointD const & pt, RegionIdVec const & regions) const;
@@ -53,8 +59,20 @@ protected:
   // Returns true when |pt| belongs to the country identified by |id|.
   virtual bool BelongsToRegion(m2::PointD const & pt, size_t id) const = 0;
 
+  // Sets |belongs[i]| to true when |points[i]| belongs to the country identified by |id|.
+  // The default implementation calls BelongsToRegion() for each point.
+  virtual void CheckPointsInRegion(size_t id, std::vector<m2::PointD> const & points,
+                                   std::vector<bool> & belongs) const;
+
+  // Loads the cells index from the packed polygons file if it has one.
+  void LoadCellsIndex(FilesContainerR const & reader);
+
   // List of all known countries.
   std::vector<CountryDef> m_countries;
+
+  // Index of countries by cells. It's empty for packed polygons files built before it, including
+  // data/packed_polygons.bin until it's regenerated, then only borders are used.
+  CountryCellsIndex m_cellsIndex;
 };
 
 // *NOTE* This class is thread-safe.
@@ -147,6 +165,8 @@ protected:
   bool BelongsToRegion(m2::PointD const & pt, size_t id) const override;
   bool IsIntersectedByRegion(m2::RectD const & rect, size_t id) const override;
   bool IsCloseEnough(size_t id, m2::PointD const & pt, double distance) const override;
+  void CheckPointsInRegion(size_t id, std::vector<m2::PointD> const & points,
+                           std::vector<bool> & belongs) const override;
 
   template <typename Fn>
   std::invoke_result_t<Fn, std::vector<m2::RegionD>> WithRegion(size_t id, Fn && fn) const;
@@ -15,6 +15,7 @@
 #include "base/logging.hpp"
 #include "base/string_utils.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <utility>
 #include <vector>
@@ -30,6 +31,7 @@ CountryInfoReader::CountryInfoReader()
     m_reader = std::make_unique<FilesContainerR>(GetPlatform().GetReader(PACKED_POLYGONS_FILE));
     ReaderSource<ModelReaderPtr> src(m_reader->GetReader(PACKED_POLYGONS_INFO_TAG));
     rw::Read(src, m_countries);
+    LoadCellsIndex(*m_reader);
   }
   catch (FileReader::Exception const & exception)
   {
@@ -38,6 +40,7 @@ CountryInfoReader::CountryInfoReader()
 
     m_reader.reset();
     m_countries.clear();
+    m_cellsIndex.Clear();
   }
 
   m_nameGetter.SetLocale(languages::GetCurrentTwine());
@@ -74,6 +77,22 @@ bool CountryInfoReader::BelongsToRegion(m2::PointD const & pt, size_t id) const
   return false;
 }
 
+void CountryInfoReader::CheckPointsInRegion(size_t id, std::vector<m2::PointD> const & points,
+                                            std::vector<bool> & belongs) const
+{
+  // Borders are loaded once for all points.
+  std::vector<m2::RegionD> regions;
+  LoadRegionsFromDisk(id, regions);
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    if (!m_countries[id].m_rect.IsPointInside(points[i]))
+      continue;
+
+    belongs[i] = std::any_of(regions.begin(), regions.end(),
+                             [&](m2::RegionD const & region) { return region.Contains(points[i]); });
+  }
+}
+
 CountryInfoReader::Info CountryInfoReader::GetMwmInfo(m2::PointD const & pt) const
 {
   Info info;
@@ -34,6 +34,8 @@ protected:
 
   // storage::CountryInfoGetterBase overrides:
   bool BelongsToRegion(m2::PointD const & pt, size_t id) const override;
+  void CheckPointsInRegion(size_t id, std::vector<m2::PointD> const & points,
+                           std::vector<bool> & belongs) const override;
 
 private:
   std::unique_ptr<FilesContainerR> m_reader;
@@ -13,24 +13,6 @@
 
 using namespace std::placeholders;
 
-namespace
-{
-class ErrorHttpRequest : public downloader::HttpRequest
-{
-public:
-  explicit ErrorHttpRequest(std::string const & filePath)
-  : HttpRequest(Callback(), Callback()), m_filePath(filePath)
-  {
-    m_status = downloader::DownloadStatus::Failed;
-  }
-
-  virtual std::string const & GetData() const { return m_filePath; }
-
-private:
-  std::string m_filePath;
-};
-}  // anonymous namespace
-
 namespace storage
 {
 HttpMapFilesDownloader::~HttpMapFilesDownloader()
@@ -38,43 +20,80 @@ HttpMapFilesDownloader::~HttpMapFilesDownloader()
   CHECK_THREAD_CHECKER(m_checker, ());
 }
 
+void HttpMapFilesDownloader::SetMaxParallelDownloads(size_t count)
+{
+  CHECK_THREAD_CHECKER(m_checker, ());
+  CHECK_GREATER(count, 0, ());
+
+  m_maxParallelDownloads = count;
+  Download();
+}
+
 void HttpMapFilesDownloader::Download(QueuedCountry && queuedCountry)
 {
   CHECK_THREAD_CHECKER(m_checker, ());
 
   m_queue.Append(std::move(queuedCountry));
 
-  if (m_queue.Count() == 1)
-    Download();
+  Download();
 }
 
 void HttpMapFilesDownloader::Download()
 {
   CHECK_THREAD_CHECKER(m_checker, ());
 
-  auto const & queuedCountry = m_queue.GetFirstCountry();
+  while (m_requests.size() < m_maxParallelDownloads)
+  {
+    // The queue may be changed by finish callbacks of failed countries, so look for
+    // the first waiting country anew every time.
+    QueuedCountry const * waiting = nullptr;
+    m_queue.ForEachCountry([this, &waiting](QueuedCountry const & country)
+    {
+      if (waiting == nullptr && m_requests.count(country.GetCountryId()) == 0)
+        waiting = &country;
+    });
+
+    if (waiting == nullptr)
+      return;
+
+    auto const copy = *waiting;
+    StartDownloading(copy);
+  }
+}
+
+void HttpMapFilesDownloader::StartDownloading(QueuedCountry const & queuedCountry)
+{
+  CHECK_THREAD_CHECKER(m_checker, ());
 
   auto const urls = MakeUrlList(queuedCountry.GetRelativeUrl());
   auto const path = queuedCountry.GetFileDownloadPath();
   auto const size = queuedCountry.GetDownloadSize();
 
-  m_request.reset();
-
   if (IsDownloadingAllowed())
   {
+    // Every downloading country gets an equal share of connections, so a big country
+    // doesn't take the whole bandwidth from the smaller ones.
+    size_t const connectionsPerServer =
+        std::max(kMaxConnectionsPerServer / m_maxParallelDownloads, size_t{1});
+
     queuedCountry.OnStartDownloading();
 
-    m_request.reset(downloader::HttpRequest::GetFile(
+    std::unique_ptr<downloader::HttpRequest> request(downloader::HttpRequest::GetFile(
         urls, path, size,
         std::bind(&HttpMapFilesDownloader::OnMapFileDownloaded, this, queuedCountry, _1),
-        std::bind(&HttpMapFilesDownloader::OnMapFileDownloadingProgress, this, queuedCountry, _1)));
-  }
-  else
-  {
-    ErrorHttpRequest error(path);
-    auto const copy = queuedCountry;
-    OnMapFileDownloaded(copy, error);
+        std::bind(&HttpMapFilesDownloader::OnMapFileDownloadingProgress, this, queuedCountry, _1),
+        512 * 1024 /* chunkSize */, true /* doCleanOnCancel */, connectionsPerServer));
+
+    if (request)
+    {
+      m_requests[queuedCountry.GetCountryId()] = std::move(request);
+      return;
+    }
   }
+
+  // Downloading is not allowed or the file can't be created.
+  m_queue.Remove(queuedCountry.GetCountryId());
+  queuedCountry.OnDownloadFinished(downloader::DownloadStatus::Failed);
 }
 
 void HttpMapFilesDownloader::Remove(CountryId const & id)
@@ -86,13 +105,10 @@ void HttpMapFilesDownloader::Remove(CountryId const & id)
   if (!m_queue.Contains(id))
     return;
 
-  if (m_request && m_queue.GetFirstId() == id)
-    m_request.reset();
-
+  m_requests.erase(id);
   m_queue.Remove(id);
 
-  if (!m_queue.IsEmpty() && !m_request)
-    Download();
+  Download();
 }
 
 void HttpMapFilesDownloader::Clear()
@@ -101,7 +117,7 @@ void HttpMapFilesDownloader::Clear()
 
   MapFilesDownloader::Clear();
 
-  m_request.reset();
+  m_requests.clear();
   m_queue.Clear();
 }
 
@@ -121,17 +137,18 @@ void HttpMapFilesDownloader::OnMapFileDownloaded(QueuedCountry const & queuedCou
   CHECK_THREAD_CHECKER(m_checker, ());
   // Because this method is called deferred on original thread,
   // it is possible the country is already removed from queue.
-  if (m_queue.IsEmpty() || m_queue.GetFirstId() != queuedCountry.GetCountryId())
+  auto const it = m_requests.find(queuedCountry.GetCountryId());
+  if (it == m_requests.end())
     return;
 
-  m_queue.PopFront();
-
-  queuedCountry.OnDownloadFinished(request.GetStatus());
+  // The request is destroyed after this callback returns.
+  auto const finished = std::move(it->second);
+  m_requests.erase(it);
+  m_queue.Remove(queuedCountry.GetCountryId());
 
-  m_request.reset();
+  queuedCountry.OnDownloadFinished(request.GetStatus(), request.GetFileSha1());
 
-  if (!m_queue.IsEmpty())
-    Download();
+  Download();
 }
 
 void HttpMapFilesDownloader::OnMapFileDownloadingProgress(QueuedCountry const & queuedCountry,
@@ -140,7 +157,7 @@ void HttpMapFilesDownloader::OnMapFileDownloadingProgress(QueuedCountry const &
   CHECK_THREAD_CHECKER(m_checker, ());
   // Because of this method calls deferred on original thread,
   // it is possible the country is already removed from queue.
-  if (m_queue.IsEmpty() || m_queue.GetFirstId() != queuedCountry.GetCountryId())
+  if (m_requests.count(queuedCountry.GetCountryId()) == 0)
     return;
 
   queuedCountry.OnDownloadProgress(request.GetProgress());
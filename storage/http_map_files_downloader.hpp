@@ -7,7 +7,9 @@
 
 #include "base/thread_checker.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -16,13 +18,24 @@ namespace storage
 {
 /// This class encapsulates HTTP requests for receiving server lists
 /// and file downloading.
+/// Several countries from the head of the queue are downloaded simultaneously,
+/// every one of them by parallel range requests.
 //
 // *NOTE*, this class is not thread-safe.
 class HttpMapFilesDownloader : public MapFilesDownloaderWithPing
 {
 public:
+  static size_t constexpr kDefaultMaxParallelDownloads = 3;
+  /// Total number of range requests to one server, it's shared equally between
+  /// simultaneously downloaded countries.
+  static size_t constexpr kMaxConnectionsPerServer = 6;
+
   virtual ~HttpMapFilesDownloader();
 
+  /// Takes effect for countries which start downloading after the call.
+  void SetMaxParallelDownloads(size_t count);
+  size_t GetActiveDownloadsCount() const { return m_requests.size(); }
+
   // MapFilesDownloader overrides:
   void Remove(CountryId const & id) override;
   void Clear() override;
@@ -32,14 +45,17 @@ private:
   // MapFilesDownloaderWithServerList overrides:
   void Download(QueuedCountry && queuedCountry) override;
 
+  /// Starts queued countries while there are free downloading slots.
   void Download();
+  void StartDownloading(QueuedCountry const & queuedCountry);
 
   void OnMapFileDownloaded(QueuedCountry const & queuedCountry, downloader::HttpRequest & request);
   void OnMapFileDownloadingProgress(QueuedCountry const & queuedCountry,
                                     downloader::HttpRequest & request);
 
-  std::unique_ptr<downloader::HttpRequest> m_request;
+  std::map<CountryId, std::unique_ptr<downloader::HttpRequest>> m_requests;
   Queue m_queue;
+  size_t m_maxParallelDownloads = kDefaultMaxParallelDownloads;
 
   DECLARE_THREAD_CHECKER(m_checker);
 };
@@ -95,10 +95,11 @@ void QueuedCountry::OnDownloadProgress(downloader::Progress const & progress) co
     m_subscriber->OnDownloadProgress(*this, progress);
 }
 
-void QueuedCountry::OnDownloadFinished(downloader::DownloadStatus status) const
+void QueuedCountry::OnDownloadFinished(downloader::DownloadStatus status,
+                                       std::string const & fileSha1) const
 {
   if (m_subscriber != nullptr)
-    m_subscriber->OnDownloadFinished(*this, status);
+    m_subscriber->OnDownloadFinished(*this, status, fileSha1);
 }
 
 bool QueuedCountry::operator==(CountryId const & countryId) const
@@ -702,7 +702,8 @@ void Storage::OnDownloadProgress(QueuedCountry const & queuedCountry, Progress c
   ReportProgressForHierarchy(queuedCountry.GetCountryId(), progress);
 }
 
-void Storage::OnDownloadFinished(QueuedCountry const & queuedCountry, DownloadStatus status)
+void Storage::OnDownloadFinished(QueuedCountry const & queuedCountry, DownloadStatus status,
+                                 string const & fileSha1)
 {
   CHECK_THREAD_CHECKER(m_threadChecker, ());
 
@@ -718,14 +719,24 @@ void Storage::OnDownloadFinished(QueuedCountry const & queuedCountry, DownloadSt
 
   if (status == DownloadStatus::Completed && m_integrityValidationEnabled)
   {
-    /// @todo Can/Should be combined with ApplyDiff routine when we will restore it.
-    /// While this is simple and working solution, I think that Downloader component
-    /// should make this kind of checks (taking expecting SHA as input). But now it's
-    /// not so simple as it may seem ..
+    auto const path = GetFileDownloadPath(countryId, fileType);
+    auto const sha1 = GetCountryFile(countryId).GetSha1();
 
-    GetPlatform().RunTask(Platform::Thread::File, [path = GetFileDownloadPath(countryId, fileType),
-                                                   sha1 = GetCountryFile(countryId).GetSha1(),
-                                                   fn = std::move(finishFn)]()
+    // Usually the hash is calculated while downloading, so the file isn't read again.
+    if (!fileSha1.empty())
+    {
+      if (fileSha1 != sha1)
+      {
+        LOG(LERROR, ("SHA check error for", path));
+        base::DeleteFileX(path);
+        status = DownloadStatus::FailedSHA;
+      }
+      finishFn(status);
+      return;
+    }
+
+    /// @todo Can/Should be combined with ApplyDiff routine when we will restore it.
+    GetPlatform().RunTask(Platform::Thread::File, [path, sha1, fn = std::move(finishFn)]()
     {
       DownloadStatus status = DownloadStatus::Completed;
 
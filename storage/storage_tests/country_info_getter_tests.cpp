@@ -4,10 +4,18 @@
 #include "storage/storage_tests/helpers.hpp"
 
 #include "storage/country.hpp"
+#include "storage/country_cells_index.hpp"
 #include "storage/country_decl.hpp"
 #include "storage/country_info_getter.hpp"
 #include "storage/storage.hpp"
 
+#include "coding/file_reader.hpp"
+#include "coding/file_writer.hpp"
+#include "coding/files_container.hpp"
+#include "coding/internal/file_data.hpp"
+#include "coding/reader.hpp"
+#include "coding/writer.hpp"
+
 #include "geometry/mercator.hpp"
 #include "geometry/point2d.hpp"
 #include "geometry/rect2d.hpp"
@@ -16,17 +24,24 @@
 #include "platform/platform.hpp"
 
 #include "base/assert.hpp"
+#include "base/file_name_utils.hpp"
 #include "base/logging.hpp"
+#include "base/scope_guard.hpp"
 #include "base/stats.hpp"
 #include "base/timer.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <map>
 #include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "defines.hpp"
+
 using namespace storage;
 using namespace std;
 
@@ -67,6 +82,65 @@ private:
   discrete_distribution<size_t> m_distr;
 };
 
+// Reader of packed polygons from any file.
+class CountryInfoReaderForTesting : public CountryInfoReader
+{
+public:
+  explicit CountryInfoReaderForTesting(string const & packedPolygonsPath)
+    : CountryInfoReader(ModelReaderPtr(make_unique<FileReader>(packedPolygonsPath)),
+                        GetPlatform().GetReader(COUNTRIES_FILE))
+  {
+  }
+
+  bool HasCellsIndex() const { return !m_cellsIndex.IsEmpty(); }
+};
+
+CountryCellsIndex::CountriesBorders LoadBorders(CountryInfoReader const & reader)
+{
+  CountryCellsIndex::CountriesBorders borders(reader.GetCountries().size());
+  for (size_t i = 0; i < borders.size(); ++i)
+    reader.LoadRegionsFromDisk(i, borders[i]);
+  return borders;
+}
+
+// Points are sampled around borders, where boundary and inner cells are mixed and countries may overlap.
+vector<m2::PointD> GetPointsNearBorders(CountryCellsIndex::CountriesBorders const & borders)
+{
+  mt19937 rng(0);
+  uniform_real_distribution<double> distrOffset(-0.5, 0.5);
+  vector<m2::PointD> points;
+  for (auto const & regions : borders)
+  {
+    for (auto const & region : regions)
+    {
+      auto const & regionPoints = region.Data();
+      for (size_t i = 0; i < regionPoints.size(); i += 500)
+        points.emplace_back(regionPoints[i].x + distrOffset(rng), regionPoints[i].y + distrOffset(rng));
+    }
+  }
+  return points;
+}
+
+// data/packed_polygons.bin has no cells index until it's regenerated, so the index is built
+// by the borders and is added to a copy of the file, like the generator does.
+void WritePackedPolygonsWithCellsIndex(CountryCellsIndex::CountriesBorders const & borders,
+                                       string const & path)
+{
+  {
+    string data;
+    GetPlatform().GetReader(PACKED_POLYGONS_FILE)->ReadAsString(data);
+    FileWriter writer(path);
+    writer.Write(data.data(), data.size());
+  }
+
+  CountryCellsIndex index;
+  index.Build(borders);
+
+  FilesContainerW container(path, FileWriter::OP_APPEND);
+  auto writer = container.GetWriter(PACKED_POLYGONS_CELLS_TAG);
+  index.Serialize(*writer);
+}
+
 template <typename Cont>
 Cont Flatten(vector<Cont> const & cs)
 {
@@ -286,6 +360,157 @@ UNIT_TEST(CountryInfoGetter_Countries_And_Polygons)
   }
 }
 
+UNIT_TEST(CountryInfoGetter_CellsIndex)
+{
+  auto reader = CountryInfoReader::CreateCountryInfoReader(GetPlatform());
+  CHECK(reader != nullptr, ());
+
+  auto const & countryDefs = reader->GetCountries();
+  auto const borders = LoadBorders(*reader);
+
+  CountryCellsIndex index;
+  index.Build(borders);
+  TEST(!index.IsEmpty(), ());
+
+  vector<uint8_t> buffer;
+  {
+    MemWriter<vector<uint8_t>> writer(buffer);
+    index.Serialize(writer);
+  }
+  CountryCellsIndex loadedIndex;
+  {
+    MemReader memReader(buffer.data(), buffer.size());
+    ReaderSource<MemReader> src(memReader);
+    loadedIndex.Deserialize(src);
+  }
+  TEST_EQUAL(loadedIndex.GetNodesCount(), index.GetNodesCount(), ());
+
+  // Points near borders are checked against the brute force search over all borders.
+  auto const points = GetPointsNearBorders(borders);
+  TEST_GREATER(points.size(), 1000, ());
+
+  auto const findFirstCountry = [&](m2::PointD const & pt)
+  {
+    for (size_t i = 0; i < countryDefs.size(); ++i)
+    {
+      if (!countryDefs[i].m_rect.IsPointInside(pt))
+        continue;
+      for (auto const & region : borders[i])
+      {
+        if (region.Contains(pt))
+          return i;
+      }
+    }
+    return CountryCellsIndex::kNoRegion;
+  };
+
+  size_t found = 0;
+  for (auto const & pt : points)
+  {
+    CountryCellsIndex::RegionId id;
+    if (!loadedIndex.Find(pt, id))
+      continue;
+
+    ++found;
+    TEST_EQUAL(id, findFirstCountry(pt), (mercator::ToLatLon(pt)));
+  }
+  TEST_GREATER(found, 0, ());
+  LOG(LINFO, ("Points near borders:", points.size(), "resolved by the index:", found));
+}
+
+UNIT_TEST(CountryInfoGetter_CellsIndexSection)
+{
+  auto const reader = CountryInfoReader::CreateCountryInfoReader(GetPlatform());
+  CHECK(reader != nullptr, ());
+  auto const borders = LoadBorders(*reader);
+
+  string const path = base::JoinPath(GetPlatform().TmpDir(), "packed_polygons_with_cells.bin");
+  SCOPE_GUARD(fileGuard, bind(&base::DeleteFileX, path));
+  WritePackedPolygonsWithCellsIndex(borders, path);
+
+  CountryInfoReaderForTesting indexedReader(path);
+  TEST(indexedReader.HasCellsIndex(), ());
+  auto const & countryDefs = reader->GetCountries();
+  TEST_EQUAL(indexedReader.GetCountries().size(), countryDefs.size(), ());
+
+  // Results with and without the index are the same.
+  for (auto const & pt : GetPointsNearBorders(borders))
+  {
+    TEST_EQUAL(indexedReader.GetRegionCountryId(pt), reader->GetRegionCountryId(pt), (mercator::ToLatLon(pt)));
+
+    CountryInfoGetter::RegionIdVec candidates;
+    for (size_t i = 0; i < countryDefs.size(); ++i)
+    {
+      if (countryDefs[i].m_rect.IsPointInside(pt))
+        candidates.push_back(i);
+    }
+
+    auto const checkRegions = [&](CountryInfoGetter::RegionIdVec const & regions)
+    {
+      TEST_EQUAL(indexedReader.BelongsToAnyRegion(pt, regions), reader->BelongsToAnyRegion(pt, regions),
+                 (mercator::ToLatLon(pt), regions));
+    };
+
+    checkRegions(candidates);
+    for (auto const id : candidates)
+    {
+      checkRegions({id});
+      // Other countries overlapping the cell of the first country.
+      auto others = candidates;
+      others.erase(find(others.begin(), others.end(), id));
+      checkRegions(others);
+    }
+  }
+}
+
+UNIT_TEST(CountryInfoGetter_RegionCountryIds)
+{
+  auto const reader = CountryInfoReader::CreateCountryInfoReader(GetPlatform());
+  CHECK(reader != nullptr, ());
+  auto const borders = LoadBorders(*reader);
+
+  string const path = base::JoinPath(GetPlatform().TmpDir(), "packed_polygons_with_cells.bin");
+  SCOPE_GUARD(fileGuard, bind(&base::DeleteFileX, path));
+  WritePackedPolygonsWithCellsIndex(borders, path);
+  CountryInfoReaderForTesting indexedReader(path);
+
+  auto const points = GetPointsNearBorders(borders);
+  size_t constexpr kThreadsCount = 4;
+  size_t const chunkSize = (points.size() + kThreadsCount - 1) / kThreadsCount;
+
+  // Both readers are used concurrently, results are checked after the threads are finished.
+  vector<vector<m2::PointD>> chunks(kThreadsCount);
+  vector<CountriesVec> results(kThreadsCount);
+  vector<CountriesVec> indexedResults(kThreadsCount);
+  vector<thread> threads;
+  for (size_t i = 0; i < kThreadsCount; ++i)
+  {
+    auto const begin = points.begin() + min(points.size(), i * chunkSize);
+    auto const end = points.begin() + min(points.size(), (i + 1) * chunkSize);
+    chunks[i].assign(begin, end);
+    threads.emplace_back([&, i]()
+    {
+      reader->GetRegionCountryIds(chunks[i], results[i]);
+      indexedReader.GetRegionCountryIds(chunks[i], indexedResults[i]);
+    });
+  }
+  for (auto & t : threads)
+    t.join();
+
+  for (size_t i = 0; i < kThreadsCount; ++i)
+  {
+    TEST_EQUAL(results[i].size(), chunks[i].size(), ());
+    TEST_EQUAL(indexedResults[i].size(), chunks[i].size(), ());
+    for (size_t j = 0; j < chunks[i].size(); ++j)
+    {
+      auto const & pt = chunks[i][j];
+      auto const countryId = reader->GetRegionCountryId(pt);
+      TEST_EQUAL(results[i][j], countryId, (mercator::ToLatLon(pt)));
+      TEST_EQUAL(indexedResults[i][j], countryId, (mercator::ToLatLon(pt)));
+    }
+  }
+}
+
 BENCHMARK_TEST(CountryInfoGetter_RegionsByRect)
 {
   auto reader = CountryInfoReader::CreateCountryInfoReader(GetPlatform());
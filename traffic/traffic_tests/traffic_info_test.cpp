@@ -33,9 +33,9 @@ protected:
     return info;
   }
 
-  unique_ptr<MwmValue> CreateValue(MwmInfo & info) const override
+  unique_ptr<MwmValue> CreateValue(MwmInfo &, platform::LocalCountryFile const & localFile) const override
   {
-    return make_unique<MwmValue>(info.GetLocalFile());
+    return make_unique<MwmValue>(localFile);
   }
 };
 }  // namespace